@@ -5,7 +5,10 @@
 
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture identifier as void*/ImTextureID. Read the FAQ about ImTextureID!
-//  [x] Renderer: Desktop GL only: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [x] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices. Without base vertex support (GL ES, WebGL, GL < 3.2), large lists are drawn with 32-bit indices.
+//  [x] Renderer: Desktop GL 4.4+ only: Upload all vertices/indices once per frame into persistent-mapped ring buffers.
+//  [X] Renderer: Support for compact 12 bytes vertices (IMGUI_USE_COMPACT_DRAWVERT).
+//  [x] Renderer: Desktop GL 3.3+ and GL ES 3.0 only: Instanced rendering of ImDrawShape (ImGuiBackendFlags_RendererHasShapes) with a distance field shader.
 
 // You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
 // Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
@@ -14,6 +17,10 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2021-08-05: OpenGL: Desktop GL 3.3+ and GL ES 3.0: Render ImDrawCallback_Shapes commands with instancing and a distance field shader, enable ImGuiBackendFlags_RendererHasShapes.
+//  2021-08-04: OpenGL: Support for large meshes without glDrawElementsBaseVertex() (GL ES 3, GL ES 2 with GL_OES_element_index_uint, WebGL, GL < 3.2) by uploading lists using multiple vertex ranges with 32-bit indices.
+//  2021-08-03: OpenGL: Support for IMGUI_USE_COMPACT_DRAWVERT (fixed-point positions scaled in projection matrix, normalized 16-bit UV).
+//  2021-07-20: OpenGL: Desktop GL 4.4+ (or GL_ARB_buffer_storage): Upload draw data into persistent-mapped ring buffers synchronized with fences, drawing with global offsets. Define IMGUI_IMPL_OPENGL_DISABLE_BUFFER_STORAGE to disable.
 //  2021-06-25: OpenGL: Use OES_vertex_array extension on Emscripten + backup/restore current state.
 //  2021-06-21: OpenGL: Destroy individual vertex/fragment shader objects right after they are linked into the main shader.
 //  2021-05-24: OpenGL: Access GL_CLIP_ORIGIN when "GL_ARB_clip_control" extension is detected, inside of just OpenGL 4.5 version.
@@ -170,6 +177,18 @@ using namespace gl;
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_EXTENSIONS
 #endif
 
+// Desktop GL 3.3+ and GL ES 3.0 have glDrawArraysInstanced() and glVertexAttribDivisor(), used to render ImDrawShape instances
+#if (!defined(IMGUI_IMPL_OPENGL_ES2) && !defined(IMGUI_IMPL_OPENGL_ES3) && defined(GL_VERSION_3_3)) || defined(IMGUI_IMPL_OPENGL_ES3)
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_SHAPES
+#endif
+
+// Desktop GL 4.4+ has glBufferStorage() for persistent-mapped buffers (we also need glDrawElementsBaseVertex() and sync objects from GL 3.2)
+// The ring buffers and their VAO are created once, so this assumes ImGui_ImplOpenGL3_RenderDrawData() is always called with the same GL context.
+// Define IMGUI_IMPL_OPENGL_DISABLE_BUFFER_STORAGE if you render with multiple GL contexts.
+#if defined(IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET) && defined(GL_VERSION_4_4) && !defined(IMGUI_IMPL_OPENGL_DISABLE_BUFFER_STORAGE)
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+#endif
+
 // OpenGL Data
 static GLuint       g_GlVersion = 0;                // Extracted at runtime using GL_MAJOR_VERSION, GL_MINOR_VERSION queries (e.g. 320 for GL 3.2)
 static char         g_GlslVersionString[32] = "";   // Specified by user or detected based on compile time GL settings.
@@ -179,6 +198,24 @@ static GLint        g_AttribLocationTex = 0, g_AttribLocationProjMtx = 0;
 static GLuint       g_AttribLocationVtxPos = 0, g_AttribLocationVtxUV = 0, g_AttribLocationVtxColor = 0; // Vertex attributes location
 static unsigned int g_VboHandle = 0, g_ElementsHandle = 0;
 static bool         g_HasClipOrigin = false;
+static bool         g_UseIdx32ForVtxOffset = false;                 // Honor ImDrawCmd::VtxOffset without glDrawElementsBaseVertex(), by uploading large lists with 32-bit indices
+static ImVector<unsigned int> g_Idx32Buffer;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_SHAPES
+static bool         g_HasShapes = false;
+static GLuint       g_ShapesShaderHandle = 0, g_ShapesVboHandle = 0;
+static GLint        g_ShapesAttribLocationProjMtx = 0;                                           // Uniforms location
+static GLuint       g_ShapesAttribLocationRect = 0, g_ShapesAttribLocationParams = 0, g_ShapesAttribLocationColor = 0, g_ShapesAttribLocationType = 0; // Instance attributes location
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+#define IMGUI_IMPL_OPENGL_RING_FRAMES 3             // Number of frames which may be in flight: each one uses a separate region of the ring buffers
+static bool         g_HasBufferStorage = false;
+static GLuint       g_RingVboHandle = 0, g_RingElementsHandle = 0, g_RingVao = 0;
+static char*        g_RingVtxMapped = NULL;         // Persistently mapped vertex buffer (IMGUI_IMPL_OPENGL_RING_FRAMES regions)
+static char*        g_RingIdxMapped = NULL;         // Persistently mapped index buffer (IMGUI_IMPL_OPENGL_RING_FRAMES regions)
+static int          g_RingVtxCapacity = 0, g_RingIdxCapacity = 0;   // Size of one region, in number of vertices/indices
+static GLsync       g_RingFences[IMGUI_IMPL_OPENGL_RING_FRAMES] = {};
+static int          g_RingFrame = 0;                // Region used by the next frame
+#endif
 
 // Functions
 bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
@@ -227,6 +264,19 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
     strcpy(g_GlslVersionString, glsl_version);
     strcat(g_GlslVersionString, "\n");
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_SHAPES
+    // Shapes are rendered with instancing, and their shader needs gl_VertexID and integer operations (GLSL 130, or 300 es)
+    int glsl_version_num = 130;
+    sscanf(g_GlslVersionString, "#version %d", &glsl_version_num);
+#if defined(IMGUI_IMPL_OPENGL_ES3)
+    g_HasShapes = (glsl_version_num >= 300);
+#else
+    g_HasShapes = (g_GlVersion >= 330 && glsl_version_num >= 130);
+#endif
+    if (g_HasShapes)
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasShapes;     // We can render ImDrawCallback_Shapes commands.
+#endif
+
     // Debugging construct to make it easily visible in the IDE and debugger which GL loader has been selected.
     // The code actually never uses the 'gl_loader' variable! It is only here so you can read it!
     // If auto-detection fails or doesn't select the same GL loader file as used by your application,
@@ -268,8 +318,30 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
         const char* extension = (const char*)glGetStringi(GL_EXTENSIONS, i);
         if (extension != NULL && strcmp(extension, "GL_ARB_clip_control") == 0)
             g_HasClipOrigin = true;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+        if (extension != NULL && strcmp(extension, "GL_ARB_buffer_storage") == 0 && g_GlVersion >= 320)
+            g_HasBufferStorage = true;
+#endif
     }
 #endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    if (g_GlVersion >= 440)
+        g_HasBufferStorage = true;
+#endif
+
+    // Without glDrawElementsBaseVertex() (GL ES, WebGL, Desktop GL < 3.2) we can still support large meshes: lists which need multiple vertex ranges
+    // are uploaded with 32-bit indices, other lists keep using 16-bit indices. GL ES 2.0 requires the GL_OES_element_index_uint extension for that.
+    if (sizeof(ImDrawIdx) == 2 && !(io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset))
+    {
+#if defined(IMGUI_IMPL_OPENGL_ES2)
+        const char* extensions = (const char*)glGetString(GL_EXTENSIONS);
+        g_UseIdx32ForVtxOffset = (extensions != NULL && strstr(extensions, "GL_OES_element_index_uint") != NULL);
+#else
+        g_UseIdx32ForVtxOffset = true;
+#endif
+        if (g_UseIdx32ForVtxOffset)
+            io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+    }
 
     return true;
 }
@@ -285,7 +357,85 @@ void    ImGui_ImplOpenGL3_NewFrame()
         ImGui_ImplOpenGL3_CreateDeviceObjects();
 }
 
-static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_width, int fb_height, GLuint vertex_array_object)
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+static void ImGui_ImplOpenGL3_DestroyRingBuffers()
+{
+    // Deleting a mapped buffer implicitly unmaps it. The GL keeps buffers alive while they are still used by pending commands.
+    for (int n = 0; n < IMGUI_IMPL_OPENGL_RING_FRAMES; n++)
+        if (g_RingFences[n]) { glDeleteSync(g_RingFences[n]); g_RingFences[n] = 0; }
+    if (g_RingVboHandle)        { glDeleteBuffers(1, &g_RingVboHandle); g_RingVboHandle = 0; }
+    if (g_RingElementsHandle)   { glDeleteBuffers(1, &g_RingElementsHandle); g_RingElementsHandle = 0; }
+    if (g_RingVao)              { glDeleteVertexArrays(1, &g_RingVao); g_RingVao = 0; }
+    g_RingVtxMapped = g_RingIdxMapped = NULL;
+    g_RingVtxCapacity = g_RingIdxCapacity = 0;
+    g_RingFrame = 0;
+}
+
+static char* ImGui_ImplOpenGL3_CreateMappedBuffer(GLuint* out_buffer, GLsizeiptr size)
+{
+    // Use the GL_COPY_WRITE_BUFFER target so we don't modify the element buffer binding of the currently bound VAO
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glGenBuffers(1, out_buffer);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, *out_buffer);
+    glBufferStorage(GL_COPY_WRITE_BUFFER, size, NULL, flags);
+    return (char*)glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, size, flags);
+}
+
+// Copy all vertices/indices of the frame contiguously into the next region of the ring buffers, growing them if needed.
+// Output the position of the region in number of vertices/indices. Return false if buffers couldn't be created/mapped.
+static bool ImGui_ImplOpenGL3_UploadRingBuffers(ImDrawData* draw_data, int* out_vtx_base, int* out_idx_base)
+{
+    if (draw_data->TotalVtxCount > g_RingVtxCapacity || draw_data->TotalIdxCount > g_RingIdxCapacity)
+    {
+        int vtx_capacity = (g_RingVtxCapacity > 0) ? g_RingVtxCapacity * 2 : 1024 * 16;
+        int idx_capacity = (g_RingIdxCapacity > 0) ? g_RingIdxCapacity * 2 : 1024 * 32;
+        if (vtx_capacity < draw_data->TotalVtxCount)
+            vtx_capacity = draw_data->TotalVtxCount;
+        if (idx_capacity < draw_data->TotalIdxCount)
+            idx_capacity = draw_data->TotalIdxCount;
+        ImGui_ImplOpenGL3_DestroyRingBuffers();
+        GLint last_copy_write_buffer; glGetIntegerv(GL_COPY_WRITE_BUFFER_BINDING, &last_copy_write_buffer);
+        g_RingVtxMapped = ImGui_ImplOpenGL3_CreateMappedBuffer(&g_RingVboHandle, (GLsizeiptr)vtx_capacity * IMGUI_IMPL_OPENGL_RING_FRAMES * (int)sizeof(ImDrawVert));
+        g_RingIdxMapped = ImGui_ImplOpenGL3_CreateMappedBuffer(&g_RingElementsHandle, (GLsizeiptr)idx_capacity * IMGUI_IMPL_OPENGL_RING_FRAMES * (int)sizeof(ImDrawIdx));
+        glBindBuffer(GL_COPY_WRITE_BUFFER, (GLuint)last_copy_write_buffer);
+        if (g_RingVtxMapped == NULL || g_RingIdxMapped == NULL)
+        {
+            ImGui_ImplOpenGL3_DestroyRingBuffers();
+            return false;
+        }
+        g_RingVtxCapacity = vtx_capacity;
+        g_RingIdxCapacity = idx_capacity;
+        glGenVertexArrays(1, &g_RingVao);
+    }
+
+    // Wait until the GPU is done with the region we are about to overwrite (rendered IMGUI_IMPL_OPENGL_RING_FRAMES frames ago)
+    const int frame = g_RingFrame;
+    if (g_RingFences[frame])
+    {
+        GLenum wait_result = glClientWaitSync(g_RingFences[frame], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+        while (wait_result == GL_TIMEOUT_EXPIRED)
+            wait_result = glClientWaitSync(g_RingFences[frame], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+        glDeleteSync(g_RingFences[frame]);
+        g_RingFences[frame] = 0;
+    }
+
+    *out_vtx_base = frame * g_RingVtxCapacity;
+    *out_idx_base = frame * g_RingIdxCapacity;
+    ImDrawVert* vtx_dst = (ImDrawVert*)(void*)g_RingVtxMapped + *out_vtx_base;
+    ImDrawIdx* idx_dst = (ImDrawIdx*)(void*)g_RingIdxMapped + *out_idx_base;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        memcpy(vtx_dst, cmd_list->VtxBuffer.Data, (size_t)cmd_list->VtxBuffer.Size * sizeof(ImDrawVert));
+        memcpy(idx_dst, cmd_list->IdxBuffer.Data, (size_t)cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx));
+        vtx_dst += cmd_list->VtxBuffer.Size;
+        idx_dst += cmd_list->IdxBuffer.Size;
+    }
+    return true;
+}
+#endif
+
+static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_width, int fb_height, GLuint vertex_array_object, bool use_ring_buffers)
 {
     // Setup render state: alpha-blending enabled, no face culling, no depth testing, scissor enabled, polygon fill
     glEnable(GL_BLEND);
@@ -323,14 +473,31 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     float B = draw_data->DisplayPos.y + draw_data->DisplaySize.y;
 #if defined(GL_CLIP_ORIGIN)
     if (!clip_origin_lower_left) { float tmp = T; T = B; B = tmp; } // Swap top and bottom if origin is upper left
+#endif
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    const float S = IM_DRAWVERT_POS_TO_FLOAT; // Compact vertices store positions in fixed-point: fold the conversion into the projection.
+#else
+    const float S = 1.0f;
 #endif
     const float ortho_projection[4][4] =
     {
-        { 2.0f/(R-L),   0.0f,         0.0f,   0.0f },
-        { 0.0f,         2.0f/(T-B),   0.0f,   0.0f },
+        { S*2.0f/(R-L), 0.0f,         0.0f,   0.0f },
+        { 0.0f,         S*2.0f/(T-B), 0.0f,   0.0f },
         { 0.0f,         0.0f,        -1.0f,   0.0f },
         { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
     };
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_SHAPES
+    if (g_ShapesShaderHandle)
+    {
+        // Shapes use float coordinates: remove the IMGUI_USE_COMPACT_DRAWVERT scale
+        float shapes_projection[4][4];
+        memcpy(shapes_projection, ortho_projection, sizeof(ortho_projection));
+        shapes_projection[0][0] /= S;
+        shapes_projection[1][1] /= S;
+        glUseProgram(g_ShapesShaderHandle);
+        glUniformMatrix4fv(g_ShapesAttribLocationProjMtx, 1, GL_FALSE, &shapes_projection[0][0]);
+    }
+#endif
     glUseProgram(g_ShaderHandle);
     glUniform1i(g_AttribLocationTex, 0);
     glUniformMatrix4fv(g_AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
@@ -346,21 +513,71 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
 #endif
 
     // Bind vertex/index buffers and setup attributes for ImDrawVert
-    glBindBuffer(GL_ARRAY_BUFFER, g_VboHandle);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, g_ElementsHandle);
+    (void)use_ring_buffers;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    if (use_ring_buffers)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, g_RingVboHandle);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, g_RingElementsHandle);
+    }
+    else
+#endif
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, g_VboHandle);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, g_ElementsHandle);
+    }
     glEnableVertexAttribArray(g_AttribLocationVtxPos);
     glEnableVertexAttribArray(g_AttribLocationVtxUV);
     glEnableVertexAttribArray(g_AttribLocationVtxColor);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    glVertexAttribPointer(g_AttribLocationVtxPos,   2, GL_SHORT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, pos));
+    glVertexAttribPointer(g_AttribLocationVtxUV,    2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, uv));
+#else
     glVertexAttribPointer(g_AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, pos));
     glVertexAttribPointer(g_AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, uv));
+#endif
     glVertexAttribPointer(g_AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE,  sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, col));
 }
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_SHAPES
+// Render 'shape_count' instances of a 4 vertices triangle strip with the shapes program, reading instance attributes from 'shape_offset' in the shapes buffer.
+// Leave the shapes program, vertex array object and buffer bound: the caller restores its own state before drawing triangles.
+static void ImGui_ImplOpenGL3_RenderShapes(GLuint vertex_array_object, unsigned int shape_offset, unsigned int shape_count)
+{
+    glUseProgram(g_ShapesShaderHandle);
+    glBindVertexArray(vertex_array_object);
+    glBindBuffer(GL_ARRAY_BUFFER, g_ShapesVboHandle);
+    const size_t base = (size_t)shape_offset * sizeof(ImDrawShape);
+    glVertexAttribPointer(g_ShapesAttribLocationRect,   4, GL_FLOAT,         GL_FALSE, sizeof(ImDrawShape), (GLvoid*)(base + IM_OFFSETOF(ImDrawShape, P1)));
+    glVertexAttribPointer(g_ShapesAttribLocationParams, 2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawShape), (GLvoid*)(base + IM_OFFSETOF(ImDrawShape, Rounding)));
+    glVertexAttribPointer(g_ShapesAttribLocationColor,  4, GL_UNSIGNED_BYTE, GL_TRUE,  sizeof(ImDrawShape), (GLvoid*)(base + IM_OFFSETOF(ImDrawShape, Col)));
+    glVertexAttribPointer(g_ShapesAttribLocationType,   1, GL_UNSIGNED_INT,  GL_FALSE, sizeof(ImDrawShape), (GLvoid*)(base + IM_OFFSETOF(ImDrawShape, Type)));
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, (GLsizei)shape_count);
+}
+
+static GLuint ImGui_ImplOpenGL3_CreateShapesVertexArray()
+{
+    const GLuint attribs[4] = { g_ShapesAttribLocationRect, g_ShapesAttribLocationParams, g_ShapesAttribLocationColor, g_ShapesAttribLocationType };
+    GLuint vertex_array_object = 0;
+    glGenVertexArrays(1, &vertex_array_object);
+    glBindVertexArray(vertex_array_object);
+    for (int n = 0; n < IM_ARRAYSIZE(attribs); n++)
+    {
+        glEnableVertexAttribArray(attribs[n]);
+        glVertexAttribDivisor(attribs[n], 1);
+    }
+    return vertex_array_object;
+}
+#endif
+
 // OpenGL3 Render function.
 // Note that this implementation is little overcomplicated because we are saving/setting up/restoring every OpenGL state explicitly.
 // This is in order to be able to run within an OpenGL engine that doesn't do so.
 void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 {
+    // This backend uploads each draw list separately, and uses ImDrawCmd::VtxOffset/IdxOffset relative to them
+    IM_ASSERT(!draw_data->BuffersMerged && "This backend doesn't support merged buffers, don't use io.RenderGetMergedBuffersFn with it.");
+
     // Avoid rendering when minimized, scale coordinates for retina displays (screen coordinates != framebuffer coordinates)
     int fb_width = (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
     int fb_height = (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
@@ -399,18 +616,41 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     GLboolean last_enable_primitive_restart = (g_GlVersion >= 310) ? glIsEnabled(GL_PRIMITIVE_RESTART) : GL_FALSE;
 #endif
 
+    // Upload all vertices/indices at once into persistent-mapped ring buffers when available.
+    // Draw calls then use global offsets: 'global_vtx_offset' and 'global_idx_offset' include the position of the frame region.
+    bool use_ring_buffers = false;
+    int global_vtx_offset = 0;
+    int global_idx_offset = 0;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    if (g_HasBufferStorage)
+    {
+        use_ring_buffers = ImGui_ImplOpenGL3_UploadRingBuffers(draw_data, &global_vtx_offset, &global_idx_offset);
+        if (!use_ring_buffers)
+            g_HasBufferStorage = false; // Failed to create or map buffers: permanently fallback to glBufferData() uploads
+    }
+#endif
+
     // Setup desired GL state
     // Recreate the VAO every time (this is to easily allow multiple GL contexts to be rendered to. VAO are not shared among GL contexts)
     // The renderer would actually work without any VAO bound, but then our VertexAttrib calls would overwrite the default one currently bound.
+    // When using ring buffers, the VAO is created along with them and kept.
     GLuint vertex_array_object = 0;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    if (use_ring_buffers)
+        vertex_array_object = g_RingVao;
+#endif
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    glGenVertexArrays(1, &vertex_array_object);
+    if (vertex_array_object == 0)
+        glGenVertexArrays(1, &vertex_array_object);
 #endif
-    ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+    ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object, use_ring_buffers);
 
     // Will project scissor/clipping rectangles into framebuffer space
     ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
     ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_SHAPES
+    GLuint shapes_vertex_array_object = 0;          // Created on first use
+#endif
 
     // Render command lists
     for (int n = 0; n < draw_data->CmdListsCount; n++)
@@ -418,18 +658,35 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
 
         // Upload vertex/index buffers
-        glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)cmd_list->VtxBuffer.Size * (int)sizeof(ImDrawVert), (const GLvoid*)cmd_list->VtxBuffer.Data, GL_STREAM_DRAW);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)cmd_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx), (const GLvoid*)cmd_list->IdxBuffer.Data, GL_STREAM_DRAW);
+        // (when we can't offset vertices natively, lists using multiple vertex ranges are converted to 32-bit indices relative to the start of their vertex buffer)
+        const bool use_idx32 = g_UseIdx32ForVtxOffset && cmd_list->IdxBufferNeeds32();
+        if (!use_ring_buffers)
+        {
+            glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)cmd_list->VtxBuffer.Size * (int)sizeof(ImDrawVert), (const GLvoid*)cmd_list->VtxBuffer.Data, GL_STREAM_DRAW);
+            if (use_idx32)
+            {
+                g_Idx32Buffer.resize(cmd_list->IdxBuffer.Size);
+                cmd_list->CopyIdxBufferAs32(g_Idx32Buffer.Data);
+                glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)g_Idx32Buffer.Size * (int)sizeof(unsigned int), (const GLvoid*)g_Idx32Buffer.Data, GL_STREAM_DRAW);
+            }
+            else
+            {
+                glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)cmd_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx), (const GLvoid*)cmd_list->IdxBuffer.Data, GL_STREAM_DRAW);
+            }
+        }
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_SHAPES
+        bool shapes_uploaded = false;
+#endif
         for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
         {
             const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
-            if (pcmd->UserCallback != NULL)
+            if (pcmd->UserCallback != NULL && pcmd->UserCallback != ImDrawCallback_Shapes)
             {
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
-                    ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+                    ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object, use_ring_buffers);
                 else
                     pcmd->UserCallback(cmd_list, pcmd);
             }
@@ -447,22 +704,66 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                     // Apply scissor/clipping rectangle
                     glScissor((int)clip_rect.x, (int)(fb_height - clip_rect.w), (int)(clip_rect.z - clip_rect.x), (int)(clip_rect.w - clip_rect.y));
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_SHAPES
+                    // Shapes: upload the shapes buffer of the list on first use, draw instances then restore our triangles state
+                    if (pcmd->UserCallback == ImDrawCallback_Shapes)
+                    {
+                        if (shapes_vertex_array_object == 0)
+                            shapes_vertex_array_object = ImGui_ImplOpenGL3_CreateShapesVertexArray();
+                        if (!shapes_uploaded)
+                        {
+                            glBindBuffer(GL_ARRAY_BUFFER, g_ShapesVboHandle);
+                            glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)cmd_list->ShapeBuffer.Size * (int)sizeof(ImDrawShape), (const GLvoid*)cmd_list->ShapeBuffer.Data, GL_STREAM_DRAW);
+                            shapes_uploaded = true;
+                        }
+                        ImGui_ImplOpenGL3_RenderShapes(shapes_vertex_array_object, pcmd->ShapeOffset, pcmd->ShapeCount);
+                        glUseProgram(g_ShaderHandle);
+                        glBindVertexArray(vertex_array_object);
+                        if (!use_ring_buffers)
+                            glBindBuffer(GL_ARRAY_BUFFER, g_VboHandle);
+                        continue;
+                    }
+#endif
+
                     // Bind texture, Draw
                     glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID());
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
                     if (g_GlVersion >= 320)
-                        glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset);
+                        glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)((pcmd->IdxOffset + global_idx_offset) * sizeof(ImDrawIdx)), (GLint)(pcmd->VtxOffset + global_vtx_offset));
                     else
 #endif
-                    glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)));
+                    if (use_idx32)
+                        glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(unsigned int)));
+                    else
+                        glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)));
                 }
             }
         }
+        if (use_ring_buffers)
+        {
+            global_vtx_offset += cmd_list->VtxBuffer.Size;
+            global_idx_offset += cmd_list->IdxBuffer.Size;
+        }
+    }
+
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_SHAPES
+    if (shapes_vertex_array_object != 0)
+        glDeleteVertexArrays(1, &shapes_vertex_array_object);
+#endif
+
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    // Fence the region we used, it will be reused in IMGUI_IMPL_OPENGL_RING_FRAMES frames
+    if (use_ring_buffers)
+    {
+        g_RingFences[g_RingFrame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        g_RingFrame = (g_RingFrame + 1) % IMGUI_IMPL_OPENGL_RING_FRAMES;
     }
+#endif
 
     // Destroy the temporary VAO
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    glDeleteVertexArrays(1, &vertex_array_object);
+    if (!use_ring_buffers)
+        glDeleteVertexArrays(1, &vertex_array_object);
 #endif
 
     // Restore modified GL state
@@ -571,6 +872,109 @@ static bool CheckProgram(GLuint handle, const char* desc)
     return (GLboolean)status == GL_TRUE;
 }
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_SHAPES
+// Each ImDrawShape instance is drawn as a quad covering the shape and its anti-aliased edge, in a local frame centered on the shape
+// (rotated along lines). The fragment shader evaluates the signed distance to a rounded box: circles are boxes fully rounded,
+// lines are boxes as long as the segment and as wide as the line, outlines use the distance to the edge.
+static void ImGui_ImplOpenGL3_CreateShapesProgram(int glsl_version)
+{
+    const GLchar* vertex_shader_glsl_130 =
+        "uniform mat4 ProjMtx;\n"
+        "in vec4 ShapeRect;\n"
+        "in vec2 ShapeParams;\n"
+        "in vec4 ShapeColor;\n"
+        "in float ShapeType;\n"
+        "out vec2 Frag_Local;\n"
+        "out vec4 Frag_Shape;\n"
+        "out vec4 Frag_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    vec2 center = (ShapeRect.xy + ShapeRect.zw) * 0.5;\n"
+        "    vec2 half_size = abs(ShapeRect.zw - ShapeRect.xy) * 0.5;\n"
+        "    vec2 axis = vec2(1.0, 0.0);\n"
+        "    float rounding = ShapeParams.x;\n"
+        "    float thickness = ShapeParams.y;\n"
+        "    if (ShapeType > 1.5)\n"
+        "    {\n"
+        "        vec2 dir = ShapeRect.zw - ShapeRect.xy;\n"
+        "        float len = length(dir);\n"
+        "        axis = (len > 0.0) ? dir / len : vec2(1.0, 0.0);\n"
+        "        half_size = vec2(len * 0.5, thickness * 0.5);\n"
+        "        thickness = 0.0;\n"
+        "    }\n"
+        "    else if (ShapeType > 0.5)\n"
+        "    {\n"
+        "        center = ShapeRect.xy;\n"
+        "        half_size = vec2(ShapeRect.z);\n"
+        "        rounding = ShapeRect.z;\n"
+        "    }\n"
+        "    vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1)) * 2.0 - 1.0;\n"
+        "    vec2 local = corner * (half_size + vec2(thickness * 0.5 + 1.0));\n"
+        "    Frag_Local = local;\n"
+        "    Frag_Shape = vec4(half_size, rounding, thickness);\n"
+        "    Frag_Color = ShapeColor;\n"
+        "    gl_Position = ProjMtx * vec4(center + axis * local.x + vec2(-axis.y, axis.x) * local.y, 0, 1);\n"
+        "}\n";
+
+    const GLchar* fragment_shader_glsl_130 =
+        "in vec2 Frag_Local;\n"
+        "in vec4 Frag_Shape;\n"
+        "in vec4 Frag_Color;\n"
+        "out vec4 Out_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    vec2 q = abs(Frag_Local) - Frag_Shape.xy + vec2(Frag_Shape.z);\n"
+        "    float d = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - Frag_Shape.z;\n"
+        "    if (Frag_Shape.w > 0.0)\n"
+        "        d = abs(d) - Frag_Shape.w * 0.5;\n"
+        "    Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * clamp(0.5 - d, 0.0, 1.0));\n"
+        "}\n";
+
+    // GLSL 300 es: same shaders with high precision, as we compute distances in pixels
+    const GLchar* precision_glsl_300_es = "precision highp float;\n";
+    const bool is_glsl_es = (glsl_version == 300);
+
+    const GLchar* vertex_shader_with_version[3] = { g_GlslVersionString, is_glsl_es ? precision_glsl_300_es : "", vertex_shader_glsl_130 };
+    GLuint vert_handle = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vert_handle, 3, vertex_shader_with_version, NULL);
+    glCompileShader(vert_handle);
+    bool ok = CheckShader(vert_handle, "shapes vertex shader");
+
+    const GLchar* fragment_shader_with_version[3] = { g_GlslVersionString, is_glsl_es ? precision_glsl_300_es : "", fragment_shader_glsl_130 };
+    GLuint frag_handle = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(frag_handle, 3, fragment_shader_with_version, NULL);
+    glCompileShader(frag_handle);
+    ok &= CheckShader(frag_handle, "shapes fragment shader");
+
+    g_ShapesShaderHandle = glCreateProgram();
+    glAttachShader(g_ShapesShaderHandle, vert_handle);
+    glAttachShader(g_ShapesShaderHandle, frag_handle);
+    glLinkProgram(g_ShapesShaderHandle);
+    ok &= CheckProgram(g_ShapesShaderHandle, "shapes shader program");
+
+    glDetachShader(g_ShapesShaderHandle, vert_handle);
+    glDetachShader(g_ShapesShaderHandle, frag_handle);
+    glDeleteShader(vert_handle);
+    glDeleteShader(frag_handle);
+
+    // If the program failed to build, stop advertising support so ImDrawList::AddShapeXXX() functions fall back to triangles
+    if (!ok)
+    {
+        glDeleteProgram(g_ShapesShaderHandle);
+        g_ShapesShaderHandle = 0;
+        g_HasShapes = false;
+        ImGui::GetIO().BackendFlags &= ~ImGuiBackendFlags_RendererHasShapes;
+        return;
+    }
+    g_ShapesAttribLocationProjMtx = glGetUniformLocation(g_ShapesShaderHandle, "ProjMtx");
+    g_ShapesAttribLocationRect = (GLuint)glGetAttribLocation(g_ShapesShaderHandle, "ShapeRect");
+    g_ShapesAttribLocationParams = (GLuint)glGetAttribLocation(g_ShapesShaderHandle, "ShapeParams");
+    g_ShapesAttribLocationColor = (GLuint)glGetAttribLocation(g_ShapesShaderHandle, "ShapeColor");
+    g_ShapesAttribLocationType = (GLuint)glGetAttribLocation(g_ShapesShaderHandle, "ShapeType");
+    glGenBuffers(1, &g_ShapesVboHandle);
+}
+#endif
+
 bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
 {
     // Backup GL state
@@ -745,6 +1149,11 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
     glGenBuffers(1, &g_VboHandle);
     glGenBuffers(1, &g_ElementsHandle);
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_SHAPES
+    if (g_HasShapes)
+        ImGui_ImplOpenGL3_CreateShapesProgram(glsl_version);
+#endif
+
     ImGui_ImplOpenGL3_CreateFontsTexture();
 
     // Restore modified GL state
@@ -762,6 +1171,14 @@ void    ImGui_ImplOpenGL3_DestroyDeviceObjects()
     if (g_VboHandle)        { glDeleteBuffers(1, &g_VboHandle); g_VboHandle = 0; }
     if (g_ElementsHandle)   { glDeleteBuffers(1, &g_ElementsHandle); g_ElementsHandle = 0; }
     if (g_ShaderHandle)     { glDeleteProgram(g_ShaderHandle); g_ShaderHandle = 0; }
+    g_Idx32Buffer.clear();
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_SHAPES
+    if (g_ShapesVboHandle)      { glDeleteBuffers(1, &g_ShapesVboHandle); g_ShapesVboHandle = 0; }
+    if (g_ShapesShaderHandle)   { glDeleteProgram(g_ShapesShaderHandle); g_ShapesShaderHandle = 0; }
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STORAGE
+    ImGui_ImplOpenGL3_DestroyRingBuffers();
+#endif
 
     ImGui_ImplOpenGL3_DestroyFontsTexture();
 }
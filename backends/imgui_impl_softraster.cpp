@@ -0,0 +1,507 @@
+// dear imgui: Renderer Backend for CPU software rasterization (no GPU required)
+// This needs to be used along with a Platform Backend (e.g. GLFW, SDL, Win32, custom..), or without any for headless rendering.
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftRaster_Texture*' as void*/ImTextureID. Read the FAQ about ImTextureID!
+//  [X] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Support for compact 12 bytes vertices (IMGUI_USE_COMPACT_DRAWVERT).
+//  [X] Renderer: Rendering a horizontal band of the output with ImGui_ImplSoftRaster_RenderDrawDataRows(), so you can split the work across your own threads.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
+// Read online: https://github.com/ocornut/imgui/tree/master/docs
+
+// CHANGELOG
+// (minor and older changes stripped away, please see git history for details)
+//  2021-08-02: Initial version.
+
+// Usage for headless rendering, e.g. screenshots or regression tests:
+//   ImGui_ImplSoftRaster_Init();
+//   [...]
+//   ImGui_ImplSoftRaster_NewFrame();
+//   ImGui::NewFrame();
+//   [...]
+//   ImGui::Render();
+//   memset(pixels, 0, width * height * sizeof(ImU32));
+//   ImGui_ImplSoftRaster_RenderDrawData(ImGui::GetDrawData(), pixels, width, height, width);
+// To use multiple threads, call ImGui_ImplSoftRaster_RenderDrawDataRows() for non-overlapping bands of rows from your job system,
+// after ImGui::Render() and before the next ImGui::NewFrame(). Each band processes the whole ImDrawData and discards triangles
+// outside of it, so prefer a few large bands (e.g. one per core) over many small ones.
+
+#include "imgui.h"
+#include "imgui_impl_softraster.h"
+#include <math.h>       // floorf
+#include <string.h>     // memcpy
+
+// Enable SSE2 for blending spans of pixels (disable by defining IMGUI_IMPL_SOFTRASTER_DISABLE_SSE2). Results are identical either way.
+#if (defined __SSE2__ || defined __x86_64__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2)) && !defined(IMGUI_IMPL_SOFTRASTER_DISABLE_SSE2)
+#define IMGUI_IMPL_SOFTRASTER_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+// Vertex positions are snapped to 1/256th of a pixel, edge functions are evaluated exactly with 64-bit integers.
+#define IMGUI_IMPL_SOFTRASTER_SUBPIXEL_BITS     8
+#define IMGUI_IMPL_SOFTRASTER_SUBPIXEL_ONE      (1 << IMGUI_IMPL_SOFTRASTER_SUBPIXEL_BITS)
+#define IMGUI_IMPL_SOFTRASTER_SUBPIXEL_HALF     (1 << (IMGUI_IMPL_SOFTRASTER_SUBPIXEL_BITS - 1))
+#define IMGUI_IMPL_SOFTRASTER_A_CHANNEL         (IM_COL32_A_SHIFT >> 3)
+
+// Software Renderer Data
+static ImGui_ImplSoftRaster_Texture g_FontTexture = { NULL, 0, 0 };
+
+// Output rectangle for the current draw command: scissor rectangle intersected with the output and band, in pixels, [X0,X1) x [Y0,Y1)
+struct ImGui_ImplSoftRaster_Target
+{
+    ImU32*      Pixels;
+    int         Stride;
+    int         X0, Y0, X1, Y1;
+    ImVec2      Offset;     // Subtracted from vertex positions (draw_data->DisplayPos)
+    ImVec2      Scale;      // Multiplied to vertex positions (draw_data->FramebufferScale)
+    const ImGui_ImplSoftRaster_Texture* Texture;
+};
+
+//-----------------------------------------------------------------------------
+// Helpers
+//-----------------------------------------------------------------------------
+
+// Exact rounded division by 255 for x in [0, 255*255]
+static inline int ImGui_ImplSoftRaster_Div255(int x)
+{
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+template<typename T> static inline T ImGui_ImplSoftRaster_Min(T a, T b) { return a < b ? a : b; }
+template<typename T> static inline T ImGui_ImplSoftRaster_Max(T a, T b) { return a >= b ? a : b; }
+
+// Floor/ceil of a/b with b > 0, for any sign of a
+static inline ImS64 ImGui_ImplSoftRaster_FloorDiv(ImS64 a, ImS64 b)
+{
+    return (a >= 0) ? (a / b) : -((-a + b - 1) / b);
+}
+
+static inline ImS64 ImGui_ImplSoftRaster_CeilDiv(ImS64 a, ImS64 b)
+{
+    return -ImGui_ImplSoftRaster_FloorDiv(-a, b);
+}
+
+// Convert a position to fixed point. Clamped to +/-2^29 so differences between two positions fit in an int, and edge functions in 64-bit integers.
+static inline int ImGui_ImplSoftRaster_Snap(float v)
+{
+    v = v * (float)IMGUI_IMPL_SOFTRASTER_SUBPIXEL_ONE;
+    const float limit = (float)(1 << 29);
+    v = (v < -limit) ? -limit : (v > limit) ? limit : v;
+    return (int)floorf(v + 0.5f);
+}
+
+// Convert a clipping coordinate to a pixel index in the [0, max] range (truncated like glScissor() in other backends)
+static inline int ImGui_ImplSoftRaster_ClipToPixel(float v, int max)
+{
+    return (v <= 0.0f) ? 0 : (v >= (float)max) ? max : (int)v;
+}
+
+// Multiply two colors channel-wise (texture * vertex color)
+static inline ImU32 ImGui_ImplSoftRaster_Modulate(ImU32 a, ImU32 b)
+{
+    if (a == 0xFFFFFFFF)
+        return b;
+    ImU32 out = 0;
+    for (int c = 0; c < 4; c++)
+        out |= (ImU32)ImGui_ImplSoftRaster_Div255((int)((a >> (c * 8)) & 0xFF) * (int)((b >> (c * 8)) & 0xFF)) << (c * 8);
+    return out;
+}
+
+// Blend 's' over 'd': color = src*src_alpha + dst*(1-src_alpha), alpha = src_alpha + dst_alpha*(1-src_alpha).
+static inline ImU32 ImGui_ImplSoftRaster_BlendPixel(ImU32 d, ImU32 s)
+{
+    const int a = (int)((s >> IM_COL32_A_SHIFT) & 0xFF);
+    if (a == 0)
+        return d;
+    if (a == 255)
+        return s;
+    ImU32 out = 0;
+    for (int c = 0; c < 4; c++)
+    {
+        const int f = (c == IMGUI_IMPL_SOFTRASTER_A_CHANNEL) ? 255 : a;
+        const int sc = (int)((s >> (c * 8)) & 0xFF);
+        const int dc = (int)((d >> (c * 8)) & 0xFF);
+        out |= (ImU32)ImGui_ImplSoftRaster_Div255(sc * f + dc * (255 - a)) << (c * 8);
+    }
+    return out;
+}
+
+// Blend a constant color over a span of pixels. Uses the same arithmetic as ImGui_ImplSoftRaster_BlendPixel().
+static void ImGui_ImplSoftRaster_BlendSpan(ImU32* dst, int count, ImU32 s)
+{
+    const int a = (int)((s >> IM_COL32_A_SHIFT) & 0xFF);
+    if (a == 0)
+        return;
+    if (a == 255)
+    {
+        for (int i = 0; i < count; i++)
+            dst[i] = s;
+        return;
+    }
+    int i = 0;
+#ifdef IMGUI_IMPL_SOFTRASTER_USE_SSE2
+    // Process 4 pixels at a time in 16-bit lanes: (src*f + 128) is constant, dst*(255-a) + (src*f + 128) <= 65153 fits unsigned 16-bit.
+    short sf[4];
+    for (int c = 0; c < 4; c++)
+        sf[c] = (short)((int)((s >> (c * 8)) & 0xFF) * ((c == IMGUI_IMPL_SOFTRASTER_A_CHANNEL) ? 255 : a) + 128);
+    const __m128i v_sf = _mm_setr_epi16(sf[0], sf[1], sf[2], sf[3], sf[0], sf[1], sf[2], sf[3]);
+    const __m128i v_inv_a = _mm_set1_epi16((short)(255 - a));
+    const __m128i v_zero = _mm_setzero_si128();
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i d = _mm_loadu_si128((const __m128i*)(dst + i));
+        __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, v_zero), v_inv_a), v_sf);
+        __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, v_zero), v_inv_a), v_sf);
+        lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(lo, hi));
+    }
+#endif
+    for (; i < count; i++)
+        dst[i] = ImGui_ImplSoftRaster_BlendPixel(dst[i], s);
+}
+
+// Bilinear filtering with clamp-to-edge addressing (equivalent to GL_LINEAR + GL_CLAMP_TO_EDGE), using 8-bit weights.
+static ImU32 ImGui_ImplSoftRaster_SampleTexture(const ImGui_ImplSoftRaster_Texture* tex, float u, float v)
+{
+    float fx = u * (float)tex->Width - 0.5f;
+    float fy = v * (float)tex->Height - 0.5f;
+    fx = (fx < -1.0f) ? -1.0f : (fx > (float)tex->Width) ? (float)tex->Width : fx;
+    fy = (fy < -1.0f) ? -1.0f : (fy > (float)tex->Height) ? (float)tex->Height : fy;
+    int x0 = (int)floorf(fx);
+    int y0 = (int)floorf(fy);
+    int wx = (int)((fx - (float)x0) * 256.0f + 0.5f);
+    int wy = (int)((fy - (float)y0) * 256.0f + 0.5f);
+    if (wx == 256) { x0++; wx = 0; }
+    if (wy == 256) { y0++; wy = 0; }
+    const int x1 = (x0 + 1 >= tex->Width) ? tex->Width - 1 : x0 + 1;
+    const int y1 = (y0 + 1 >= tex->Height) ? tex->Height - 1 : y0 + 1;
+    x0 = (x0 < 0) ? 0 : (x0 >= tex->Width) ? tex->Width - 1 : x0;
+    y0 = (y0 < 0) ? 0 : (y0 >= tex->Height) ? tex->Height - 1 : y0;
+    const ImU32* row0 = tex->Pixels + (size_t)y0 * tex->Width;
+    if (wx == 0 && wy == 0)
+        return row0[x0];
+
+    // Weights sum to 65536
+    const ImU32* row1 = tex->Pixels + (size_t)(y1 < 0 ? 0 : y1) * tex->Width;
+    const ImU32 t00 = row0[x0], t10 = row0[x1 < 0 ? 0 : x1], t01 = row1[x0], t11 = row1[x1 < 0 ? 0 : x1];
+    const int w00 = (256 - wx) * (256 - wy), w10 = wx * (256 - wy), w01 = (256 - wx) * wy, w11 = wx * wy;
+    ImU32 out = 0;
+    for (int c = 0; c < 4; c++)
+    {
+        const int shift = c * 8;
+        const int sum = (int)((t00 >> shift) & 0xFF) * w00 + (int)((t10 >> shift) & 0xFF) * w10 + (int)((t01 >> shift) & 0xFF) * w01 + (int)((t11 >> shift) & 0xFF) * w11;
+        out |= (ImU32)((sum + 32768) >> 16) << shift;
+    }
+    return out;
+}
+
+//-----------------------------------------------------------------------------
+// Rasterization
+//-----------------------------------------------------------------------------
+
+// Fast path for axis-aligned rectangles with a single color and axis-aligned UV, as emitted by ImDrawList::PrimRect()/PrimRectUV().
+// Vertices are laid out as 'a, b=(c.x,a.y), c, d=(a.x,c.y)' and indexed as (a,b,c) + (a,c,d).
+// Covers exactly the same pixels as rasterizing both triangles with the top-left rule. Return false if not applicable.
+static bool ImGui_ImplSoftRaster_RasterRect(const ImGui_ImplSoftRaster_Target& t, const ImDrawVert* va, const ImDrawVert* vb, const ImDrawVert* vc, const ImDrawVert* vd)
+{
+    const ImVec2 pa = ImDrawVertGetPos(va), pb = ImDrawVertGetPos(vb), pc = ImDrawVertGetPos(vc), pd = ImDrawVertGetPos(vd);
+    const ImVec2 uv_a = ImDrawVertGetUV(va), uv_b = ImDrawVertGetUV(vb), uv_c = ImDrawVertGetUV(vc), uv_d = ImDrawVertGetUV(vd);
+    if (pa.y != pb.y || pb.x != pc.x || pc.y != pd.y || pd.x != pa.x || pa.x == pb.x || pa.y == pc.y)
+        return false;
+    if (va->col != vb->col || va->col != vc->col || va->col != vd->col)
+        return false;
+    if (uv_a.y != uv_b.y || uv_b.x != uv_c.x || uv_c.y != uv_d.y || uv_d.x != uv_a.x)
+        return false;
+
+    // Pixel centers in [min,max) are covered
+    const int ax = ImGui_ImplSoftRaster_Snap((pa.x - t.Offset.x) * t.Scale.x);
+    const int ay = ImGui_ImplSoftRaster_Snap((pa.y - t.Offset.y) * t.Scale.y);
+    const int cx = ImGui_ImplSoftRaster_Snap((pc.x - t.Offset.x) * t.Scale.x);
+    const int cy = ImGui_ImplSoftRaster_Snap((pc.y - t.Offset.y) * t.Scale.y);
+    const int min_x = ax < cx ? ax : cx, max_x = ax < cx ? cx : ax;
+    const int min_y = ay < cy ? ay : cy, max_y = ay < cy ? cy : ay;
+    ImS64 x0 = ImGui_ImplSoftRaster_CeilDiv((ImS64)min_x - IMGUI_IMPL_SOFTRASTER_SUBPIXEL_HALF, IMGUI_IMPL_SOFTRASTER_SUBPIXEL_ONE);
+    ImS64 x1 = ImGui_ImplSoftRaster_CeilDiv((ImS64)max_x - IMGUI_IMPL_SOFTRASTER_SUBPIXEL_HALF, IMGUI_IMPL_SOFTRASTER_SUBPIXEL_ONE);
+    ImS64 y0 = ImGui_ImplSoftRaster_CeilDiv((ImS64)min_y - IMGUI_IMPL_SOFTRASTER_SUBPIXEL_HALF, IMGUI_IMPL_SOFTRASTER_SUBPIXEL_ONE);
+    ImS64 y1 = ImGui_ImplSoftRaster_CeilDiv((ImS64)max_y - IMGUI_IMPL_SOFTRASTER_SUBPIXEL_HALF, IMGUI_IMPL_SOFTRASTER_SUBPIXEL_ONE);
+    if (x0 < t.X0) x0 = t.X0;
+    if (y0 < t.Y0) y0 = t.Y0;
+    if (x1 > t.X1) x1 = t.X1;
+    if (y1 > t.Y1) y1 = t.Y1;
+    if (x0 >= x1 || y0 >= y1)
+        return true;
+
+    const ImGui_ImplSoftRaster_Texture* tex = t.Texture;
+    if (uv_a.x == uv_c.x && uv_a.y == uv_c.y)
+    {
+        // Constant color (most common case, e.g. solid rectangles using the white pixel of the font atlas)
+        const ImU32 src = ImGui_ImplSoftRaster_Modulate(ImGui_ImplSoftRaster_SampleTexture(tex, uv_a.x, uv_a.y), va->col);
+        for (ImS64 y = y0; y < y1; y++)
+            ImGui_ImplSoftRaster_BlendSpan(t.Pixels + (size_t)y * t.Stride + x0, (int)(x1 - x0), src);
+        return true;
+    }
+
+    // Textured (e.g. glyphs): UV is an affine function of each axis
+    const float fax = (float)ax / IMGUI_IMPL_SOFTRASTER_SUBPIXEL_ONE, fay = (float)ay / IMGUI_IMPL_SOFTRASTER_SUBPIXEL_ONE;
+    const float du_dx = (uv_c.x - uv_a.x) / ((float)(cx - ax) / IMGUI_IMPL_SOFTRASTER_SUBPIXEL_ONE);
+    const float dv_dy = (uv_c.y - uv_a.y) / ((float)(cy - ay) / IMGUI_IMPL_SOFTRASTER_SUBPIXEL_ONE);
+    for (ImS64 y = y0; y < y1; y++)
+    {
+        ImU32* dst = t.Pixels + (size_t)y * t.Stride;
+        const float v = uv_a.y + ((float)y + 0.5f - fay) * dv_dy;
+        for (ImS64 x = x0; x < x1; x++)
+        {
+            const float u = uv_a.x + ((float)x + 0.5f - fax) * du_dx;
+            dst[x] = ImGui_ImplSoftRaster_BlendPixel(dst[x], ImGui_ImplSoftRaster_Modulate(ImGui_ImplSoftRaster_SampleTexture(tex, u, v), va->col));
+        }
+    }
+    return true;
+}
+
+// Generic triangle: edge functions with the top-left fill rule, perspective-free barycentric interpolation of color and UV.
+static void ImGui_ImplSoftRaster_RasterTriangle(const ImGui_ImplSoftRaster_Target& t, const ImDrawVert* va, const ImDrawVert* vb, const ImDrawVert* vc)
+{
+    const ImVec2 pa = ImDrawVertGetPos(va), pb = ImDrawVertGetPos(vb), pc = ImDrawVertGetPos(vc);
+    ImVec2 uv_a = ImDrawVertGetUV(va), uv_b = ImDrawVertGetUV(vb), uv_c = ImDrawVertGetUV(vc);
+    int ax = ImGui_ImplSoftRaster_Snap((pa.x - t.Offset.x) * t.Scale.x), ay = ImGui_ImplSoftRaster_Snap((pa.y - t.Offset.y) * t.Scale.y);
+    int bx = ImGui_ImplSoftRaster_Snap((pb.x - t.Offset.x) * t.Scale.x), by = ImGui_ImplSoftRaster_Snap((pb.y - t.Offset.y) * t.Scale.y);
+    int cx = ImGui_ImplSoftRaster_Snap((pc.x - t.Offset.x) * t.Scale.x), cy = ImGui_ImplSoftRaster_Snap((pc.y - t.Offset.y) * t.Scale.y);
+    ImS64 area = (ImS64)(bx - ax) * (cy - ay) - (ImS64)(by - ay) * (cx - ax);
+    if (area == 0)
+        return;
+    if (area < 0)
+    {
+        // Make winding consistent so inside is where all edge functions are positive
+        const ImDrawVert* tv = vb; vb = vc; vc = tv;
+        const ImVec2 tuv = uv_b; uv_b = uv_c; uv_c = tuv;
+        int tx = bx; bx = cx; cx = tx;
+        int ty = by; by = cy; cy = ty;
+        area = -area;
+    }
+
+    // Bounding box of covered pixel centers, clipped
+    const int min_x = ImGui_ImplSoftRaster_Min(ax, ImGui_ImplSoftRaster_Min(bx, cx)), max_x = ImGui_ImplSoftRaster_Max(ax, ImGui_ImplSoftRaster_Max(bx, cx));
+    const int min_y = ImGui_ImplSoftRaster_Min(ay, ImGui_ImplSoftRaster_Min(by, cy)), max_y = ImGui_ImplSoftRaster_Max(ay, ImGui_ImplSoftRaster_Max(by, cy));
+    ImS64 x0 = ImGui_ImplSoftRaster_CeilDiv((ImS64)min_x - IMGUI_IMPL_SOFTRASTER_SUBPIXEL_HALF, IMGUI_IMPL_SOFTRASTER_SUBPIXEL_ONE);
+    ImS64 y0 = ImGui_ImplSoftRaster_CeilDiv((ImS64)min_y - IMGUI_IMPL_SOFTRASTER_SUBPIXEL_HALF, IMGUI_IMPL_SOFTRASTER_SUBPIXEL_ONE);
+    ImS64 x1 = ImGui_ImplSoftRaster_FloorDiv((ImS64)max_x - IMGUI_IMPL_SOFTRASTER_SUBPIXEL_HALF, IMGUI_IMPL_SOFTRASTER_SUBPIXEL_ONE) + 1;
+    ImS64 y1 = ImGui_ImplSoftRaster_FloorDiv((ImS64)max_y - IMGUI_IMPL_SOFTRASTER_SUBPIXEL_HALF, IMGUI_IMPL_SOFTRASTER_SUBPIXEL_ONE) + 1;
+    if (x0 < t.X0) x0 = t.X0;
+    if (y0 < t.Y0) y0 = t.Y0;
+    if (x1 > t.X1) x1 = t.X1;
+    if (y1 > t.Y1) y1 = t.Y1;
+    if (x0 >= x1 || y0 >= y1)
+        return;
+
+    // Edge i is opposite to vertex i: E(X,Y) = dx*(Y-py) - dy*(X-px). Pixels on an edge belong to the triangle if that edge is a top or left edge.
+    const int ex[3] = { cx - bx, ax - cx, bx - ax };
+    const int ey[3] = { cy - by, ay - cy, by - ay };
+    const int epx[3] = { bx, cx, ax };
+    const int epy[3] = { by, cy, ay };
+    ImS64 bias[3];
+    for (int i = 0; i < 3; i++)
+        bias[i] = (ey[i] < 0 || (ey[i] == 0 && ex[i] > 0)) ? 0 : 1;
+
+    // Constant attributes don't need to be interpolated
+    const ImGui_ImplSoftRaster_Texture* tex = t.Texture;
+    const bool flat_col = (va->col == vb->col && va->col == vc->col);
+    const bool flat_uv = (uv_a.x == uv_b.x && uv_a.x == uv_c.x && uv_a.y == uv_b.y && uv_a.y == uv_c.y);
+    const ImU32 flat_texel = flat_uv ? ImGui_ImplSoftRaster_SampleTexture(tex, uv_a.x, uv_a.y) : 0;
+    const ImU32 flat_src = (flat_col && flat_uv) ? ImGui_ImplSoftRaster_Modulate(flat_texel, va->col) : 0;
+    float col[3][4];
+    for (int c = 0; c < 4; c++)
+    {
+        col[0][c] = (float)((va->col >> (c * 8)) & 0xFF);
+        col[1][c] = (float)((vb->col >> (c * 8)) & 0xFF);
+        col[2][c] = (float)((vc->col >> (c * 8)) & 0xFF);
+    }
+    const float inv_area = 1.0f / (float)area;
+
+    for (ImS64 y = y0; y < y1; y++)
+    {
+        // Evaluate edge functions (minus their bias) at the first pixel of the row, then solve E(x) >= 0 for each edge to get the covered span.
+        const ImS64 py = y * IMGUI_IMPL_SOFTRASTER_SUBPIXEL_ONE + IMGUI_IMPL_SOFTRASTER_SUBPIXEL_HALF;
+        const ImS64 px = x0 * IMGUI_IMPL_SOFTRASTER_SUBPIXEL_ONE + IMGUI_IMPL_SOFTRASTER_SUBPIXEL_HALF;
+        ImS64 e[3], step[3];
+        ImS64 span_x0 = x0, span_x1 = x1;
+        for (int i = 0; i < 3; i++)
+        {
+            e[i] = (ImS64)ex[i] * (py - epy[i]) - (ImS64)ey[i] * (px - epx[i]) - bias[i];
+            step[i] = -(ImS64)ey[i] * IMGUI_IMPL_SOFTRASTER_SUBPIXEL_ONE;
+            if (step[i] == 0)
+            {
+                if (e[i] < 0)
+                    span_x1 = span_x0;
+            }
+            else if (step[i] > 0)
+            {
+                if (e[i] < 0)
+                    span_x0 = ImGui_ImplSoftRaster_Max(span_x0, x0 + ImGui_ImplSoftRaster_CeilDiv(-e[i], step[i]));
+            }
+            else
+            {
+                span_x1 = (e[i] < 0) ? span_x0 : ImGui_ImplSoftRaster_Min(span_x1, x0 + ImGui_ImplSoftRaster_FloorDiv(e[i], -step[i]) + 1);
+            }
+        }
+        if (span_x0 >= span_x1)
+            continue;
+
+        ImU32* dst = t.Pixels + (size_t)y * t.Stride;
+        if (flat_col && flat_uv)
+        {
+            ImGui_ImplSoftRaster_BlendSpan(dst + span_x0, (int)(span_x1 - span_x0), flat_src);
+            continue;
+        }
+        for (int i = 0; i < 3; i++)
+            e[i] += step[i] * (span_x0 - x0) + bias[i];
+        for (ImS64 x = span_x0; x < span_x1; x++, e[0] += step[0], e[1] += step[1], e[2] += step[2])
+        {
+            const float w0 = (float)e[0] * inv_area, w1 = (float)e[1] * inv_area, w2 = (float)e[2] * inv_area;
+            ImU32 vtx_col = va->col;
+            if (!flat_col)
+            {
+                vtx_col = 0;
+                for (int c = 0; c < 4; c++)
+                {
+                    int v = (int)(col[0][c] * w0 + col[1][c] * w1 + col[2][c] * w2 + 0.5f);
+                    vtx_col |= (ImU32)(v < 0 ? 0 : v > 255 ? 255 : v) << (c * 8);
+                }
+            }
+            const ImU32 texel = flat_uv ? flat_texel : ImGui_ImplSoftRaster_SampleTexture(tex, uv_a.x * w0 + uv_b.x * w1 + uv_c.x * w2, uv_a.y * w0 + uv_b.y * w1 + uv_c.y * w2);
+            dst[x] = ImGui_ImplSoftRaster_BlendPixel(dst[x], ImGui_ImplSoftRaster_Modulate(texel, vtx_col));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Public API
+//-----------------------------------------------------------------------------
+
+bool    ImGui_ImplSoftRaster_Init()
+{
+    // Setup backend capabilities flags
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendRendererName = "imgui_impl_softraster";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    return true;
+}
+
+void    ImGui_ImplSoftRaster_Shutdown()
+{
+    ImGui_ImplSoftRaster_DestroyFontsTexture();
+}
+
+void    ImGui_ImplSoftRaster_NewFrame()
+{
+    if (!g_FontTexture.Pixels)
+        ImGui_ImplSoftRaster_CreateFontsTexture();
+}
+
+void    ImGui_ImplSoftRaster_RenderDrawData(ImDrawData* draw_data, ImU32* pixels, int width, int height, int stride)
+{
+    ImGui_ImplSoftRaster_RenderDrawDataRows(draw_data, pixels, width, height, stride, 0, height);
+}
+
+void    ImGui_ImplSoftRaster_RenderDrawDataRows(ImDrawData* draw_data, ImU32* pixels, int width, int height, int stride, int y0, int y1)
+{
+    IM_ASSERT(pixels != NULL && stride >= width);
+    IM_ASSERT(!draw_data->BuffersMerged && "Merged buffers are meant for GPU renderers, don't use io.RenderGetMergedBuffersFn with this backend.");
+    if (y0 < 0)
+        y0 = 0;
+    if (y1 > height)
+        y1 = height;
+    if (width <= 0 || y0 >= y1)
+        return;
+
+    // Will project scissor/clipping rectangles into framebuffer space
+    ImGui_ImplSoftRaster_Target target;
+    target.Pixels = pixels;
+    target.Stride = stride;
+    target.Offset = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
+    target.Scale = draw_data->FramebufferScale;    // (1,1) unless using retina display which are often (2,2)
+
+    // Render command lists
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != NULL)
+            {
+                // User callback, registered via ImDrawList::AddCallback()
+                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+                if (pcmd->UserCallback != ImDrawCallback_ResetRenderState)
+                    pcmd->UserCallback(cmd_list, pcmd);
+                continue;
+            }
+
+            // Project scissor/clipping rectangles into framebuffer space, intersect with our band
+            target.X0 = ImGui_ImplSoftRaster_ClipToPixel((pcmd->ClipRect.x - target.Offset.x) * target.Scale.x, width);
+            target.Y0 = ImGui_ImplSoftRaster_ClipToPixel((pcmd->ClipRect.y - target.Offset.y) * target.Scale.y, height);
+            target.X1 = ImGui_ImplSoftRaster_ClipToPixel((pcmd->ClipRect.z - target.Offset.x) * target.Scale.x, width);
+            target.Y1 = ImGui_ImplSoftRaster_ClipToPixel((pcmd->ClipRect.w - target.Offset.y) * target.Scale.y, height);
+            if (target.Y0 < y0)
+                target.Y0 = y0;
+            if (target.Y1 > y1)
+                target.Y1 = y1;
+            if (target.X0 >= target.X1 || target.Y0 >= target.Y1)
+                continue;
+
+            // Bind texture, Draw
+            target.Texture = (const ImGui_ImplSoftRaster_Texture*)pcmd->GetTexID();
+            IM_ASSERT(target.Texture != NULL && target.Texture->Pixels != NULL && target.Texture->Width > 0 && target.Texture->Height > 0);
+            const ImDrawVert* vtx_buffer = cmd_list->VtxBuffer.Data + pcmd->VtxOffset;
+            const ImDrawIdx* idx_buffer = cmd_list->IdxBuffer.Data + pcmd->IdxOffset;
+            const unsigned int elem_count = pcmd->ElemCount;
+            for (unsigned int i = 0; i + 3 <= elem_count; )
+            {
+                if (i + 6 <= elem_count && idx_buffer[i + 3] == idx_buffer[i] && idx_buffer[i + 4] == idx_buffer[i + 2])
+                    if (ImGui_ImplSoftRaster_RasterRect(target, &vtx_buffer[idx_buffer[i]], &vtx_buffer[idx_buffer[i + 1]], &vtx_buffer[idx_buffer[i + 2]], &vtx_buffer[idx_buffer[i + 5]]))
+                    {
+                        i += 6;
+                        continue;
+                    }
+                ImGui_ImplSoftRaster_RasterTriangle(target, &vtx_buffer[idx_buffer[i]], &vtx_buffer[idx_buffer[i + 1]], &vtx_buffer[idx_buffer[i + 2]]);
+                i += 3;
+            }
+        }
+    }
+}
+
+bool    ImGui_ImplSoftRaster_CreateFontsTexture()
+{
+    // Build texture atlas
+    ImGuiIO& io = ImGui::GetIO();
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);   // Load as RGBA 32-bit, stored as IM_COL32() values which is our native format.
+
+    // Copy texture data, so the atlas can discard its own copy like it would do after uploading to a GPU
+    ImU32* pixels_copy = (ImU32*)IM_ALLOC((size_t)width * height * sizeof(ImU32));
+    memcpy(pixels_copy, pixels, (size_t)width * height * sizeof(ImU32));
+    g_FontTexture.Pixels = pixels_copy;
+    g_FontTexture.Width = width;
+    g_FontTexture.Height = height;
+
+    // Store our identifier
+    io.Fonts->SetTexID((ImTextureID)&g_FontTexture);
+    return true;
+}
+
+void    ImGui_ImplSoftRaster_DestroyFontsTexture()
+{
+    if (g_FontTexture.Pixels)
+    {
+        ImGuiIO& io = ImGui::GetIO();
+        IM_FREE((void*)g_FontTexture.Pixels);
+        io.Fonts->SetTexID(0);
+        g_FontTexture.Pixels = NULL;
+        g_FontTexture.Width = g_FontTexture.Height = 0;
+    }
+}
@@ -0,0 +1,44 @@
+// dear imgui: Renderer Backend for CPU software rasterization (no GPU required)
+// This needs to be used along with a Platform Backend (e.g. GLFW, SDL, Win32, custom..), or without any for headless rendering.
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftRaster_Texture*' as void*/ImTextureID. Read the FAQ about ImTextureID!
+//  [X] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Support for compact 12 bytes vertices (IMGUI_USE_COMPACT_DRAWVERT).
+//  [X] Renderer: Rendering a horizontal band of the output with ImGui_ImplSoftRaster_RenderDrawDataRows(), so you can split the work across your own threads.
+
+// Output is a 32-bit per pixel buffer using the same packing as IM_COL32() (RGBA in memory order with default IM_COL32_XXX_SHIFT).
+// Rasterization follows the GPU conventions used by other backends: pixel centers at +0.5, top-left fill rule, bilinear texture filtering
+// with clamp-to-edge, 'src_alpha, one_minus_src_alpha' blending for color and 'one, one_minus_src_alpha' for alpha, integer scissor rectangles.
+// Output is fully deterministic, regardless of how the work is split in bands, which makes it suitable for pixel-exact regression tests.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
+// Read online: https://github.com/ocornut/imgui/tree/master/docs
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+
+// Texture description. Pass a pointer to one of those as ImTextureID. Pixels are packed like IM_COL32().
+struct ImGui_ImplSoftRaster_Texture
+{
+    const ImU32*    Pixels;
+    int             Width;
+    int             Height;
+};
+
+IMGUI_IMPL_API bool     ImGui_ImplSoftRaster_Init();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_NewFrame();
+
+// Render into 'pixels' ('width' x 'height' pixels, 'stride' pixels between the start of two rows). The buffer is blended into, not cleared.
+// ImGui_ImplSoftRaster_RenderDrawDataRows() only writes to rows in the [y0,y1) range and doesn't access the ImGui context nor allocate memory,
+// so multiple calls with non-overlapping bands may run concurrently from your own threads (e.g. one band of 64 rows per job).
+// User callbacks registered with ImDrawList::AddCallback() are called once per band, from the thread rendering that band.
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_RenderDrawData(ImDrawData* draw_data, ImU32* pixels, int width, int height, int stride);
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_RenderDrawDataRows(ImDrawData* draw_data, ImU32* pixels, int width, int height, int stride, int y0, int y1);
+
+// Called by Init/NewFrame/Shutdown
+IMGUI_IMPL_API bool     ImGui_ImplSoftRaster_CreateFontsTexture();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_DestroyFontsTexture();
@@ -47,6 +47,11 @@
 //#define IMGUI_DISABLE_DEFAULT_ALLOCATORS                  // Don't implement default allocators calling malloc()/free() to avoid linking with them. You will need to call ImGui::SetAllocatorFunctions().
 //#define IMGUI_DISABLE_SSE                                 // Disable use of SSE intrinsics even if available
 
+//---- Make the current context pointer (GImGui) thread-local, so that N threads can each update their own context concurrently (e.g. one context per offscreen panel).
+// Each thread needs to call SetCurrentContext() (CreateContext() does it when no context is current on this thread). Contexts may share a font atlas, which they won't write to: build it before starting threads and don't modify it while they run.
+// Not compatible with exporting Dear ImGui from a Windows DLL (thread-local variables can't be imported).
+//#define IMGUI_USE_THREAD_LOCAL_CONTEXT
+
 //---- Include imgui_user.h at the end of imgui.h as a convenience
 //#define IMGUI_INCLUDE_IMGUI_USER_H
 
@@ -94,6 +99,13 @@
 // Read about ImGuiBackendFlags_RendererHasVtxOffset for details.
 //#define ImDrawIdx unsigned int
 
+//---- Use a compact 12 bytes vertex format (default is 20 bytes), e.g. to reduce bandwidth when uploading or streaming vertices.
+// Positions are stored as signed 16-bit fixed-point with 4 fractional bits (1/16th of a pixel, range -2048..+2047), UV as normalized unsigned 16-bit (range 0..1).
+// Values outside of those ranges are clamped. Lower IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS to trade precision for range (3 = 1/8th of a pixel, range -4096..+4095).
+// Your renderer backend will need to support it (imgui_impl_opengl3 and imgui_impl_softraster do). Cannot be used with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT.
+//#define IMGUI_USE_COMPACT_DRAWVERT
+//#define IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS 4
+
 //---- Override ImDrawCallback signature (will need to modify renderer backends accordingly)
 //struct ImDrawList;
 //struct ImDrawCmd;
@@ -113,6 +125,14 @@
 //---- Debug Tools: Enable slower asserts
 //#define IMGUI_DEBUG_PARANOID
 
+//---- Debug Tools: Enable the frame profiler, timing NewFrame()/EndFrame()/Render(), windows, tables layout, navigation and text rendering.
+// Displayed in 'Metrics->Profiler'. Adds a small runtime cost which is why it is not enabled by default. When not defined, all instrumentation compiles to nothing.
+//#define IMGUI_ENABLE_PROFILER
+
+//---- Debug Tools: Enable memory accounting per subsystem (windows, draw lists, tables, text input, fonts, settings), with bytes, counts and high-water marks.
+// Displayed in 'Metrics->Memory' and queryable with ImGui::GetMemTagStats(). Adds a 16 bytes header to each allocation made through IM_ALLOC().
+//#define IMGUI_ENABLE_MEMORY_TAGS
+
 //---- Tip: You can add extra functions within the ImGui:: namespace, here or in your own headers files.
 /*
 namespace ImGui
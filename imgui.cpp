@@ -78,6 +78,7 @@ CODE
 // [SECTION] SETTINGS
 // [SECTION] VIEWPORTS
 // [SECTION] PLATFORM DEPENDENT HELPERS
+// [SECTION] FRAME PROFILER
 // [SECTION] METRICS/DEBUGGER WINDOW
 
 */
@@ -376,6 +377,9 @@ CODE
  When you are not sure about an old symbol or function name, try using the Search/Find function of your IDE to look for comments or references in all imgui files.
  You can read releases logs https://github.com/ocornut/imgui/releases for more details.
 
+ - 2021/06/25 (1.84) - io: io.AddInputCharacter(), io.AddInputCharacterUTF16(), io.AddInputCharactersUTF8() now queue characters into the input event queue of the context owning the io,
+                       applied by the next NewFrame(). Characters added during a frame don't appear in io.InputQueueCharacters[] until the next frame anymore.
+                       If you read io.InputQueueCharacters[] right after adding characters, read it after the next NewFrame() instead. Those functions may now be called on the io of a non-current context.
  - 2021/05/19 (1.83) - backends: obsoleted direct access to ImDrawCmd::TextureId in favor of calling ImDrawCmd::GetTexID().
                         - if you are using official backends from the source tree: you have nothing to do.
                         - if you have copied old backend code or using your own: change access to draw_cmd->TextureId to draw_cmd->GetTexID().
@@ -779,6 +783,7 @@ CODE
 // System includes
 #include <ctype.h>      // toupper
 #include <stdio.h>      // vsnprintf, sscanf, printf
+#include <locale.h>     // localeconv
 #if defined(_MSC_VER) && _MSC_VER <= 1500 // MSVC 2008 or earlier
 #include <stddef.h>     // intptr_t
 #else
@@ -812,6 +817,11 @@ CODE
 #include <TargetConditionals.h>
 #endif
 
+// Frame profiler clock
+#if defined(IMGUI_ENABLE_PROFILER) && !defined(_WIN32)
+#include <time.h>           // clock_gettime
+#endif
+
 // Visual Studio warnings
 #ifdef _MSC_VER
 #pragma warning (disable: 4127)             // condition expression is constant
@@ -865,15 +875,20 @@ static const float NAV_WINDOWING_LIST_APPEAR_DELAY          = 0.15f;    // Time
 
 // Window resizing from edges (when io.ConfigWindowsResizeFromEdges = true and ImGuiBackendFlags_HasMouseCursors is set in io.BackendFlags by backend)
 static const float WINDOWS_HOVER_PADDING                    = 4.0f;     // Extend outside window for hovering/resizing (maxxed with TouchPadding) and inside windows for borders. Affect FindHoveredWindow().
+static const int   WINDOWS_HOVER_GRID_MIN_COUNT             = 32;       // Minimum number of hoverable windows for FindHoveredWindow() to use a spatial index instead of testing every window.
 static const float WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER = 0.04f;    // Reduce visual noise by only highlighting the border after a certain time.
 static const float WINDOWS_MOUSE_WHEEL_SCROLL_LOCK_TIMER    = 2.00f;    // Lock scrolled window (so it doesn't pick child windows that are scrolling through) for a certain time, unless mouse moved.
 
+// Logging to tty/file/callback
+static const int   LOG_FLUSH_SIZE                           = 64 * 1024; // Accumulate logged text and write it once we have that many bytes (or on EndFrame()/LogFinish()).
+
 //-------------------------------------------------------------------------
 // [SECTION] FORWARD DECLARATIONS
 //-------------------------------------------------------------------------
 
 static void             SetCurrentWindow(ImGuiWindow* window);
 static void             FindHoveredWindow();
+static void             UpdateWindowHoverGrid();
 static ImGuiWindow*     CreateNewWindow(const char* name, ImGuiWindowFlags flags);
 static ImVec2           CalcNextScrollFromScrollTargetAndClamp(ImGuiWindow* window);
 
@@ -886,12 +901,32 @@ static void*            WindowSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSetti
 static void             WindowSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line);
 static void             WindowSettingsHandler_ApplyAll(ImGuiContext*, ImGuiSettingsHandler*);
 static void             WindowSettingsHandler_WriteAll(ImGuiContext*, ImGuiSettingsHandler*, ImGuiTextBuffer* buf);
+static void             WindowSettingsHandler_ReadBinary(ImGuiContext*, ImGuiSettingsHandler*, ImGuiID id, const char* data, int data_size);
+static void             WindowSettingsHandler_WriteAllBinary(ImGuiContext*, ImGuiSettingsHandler*, ImVector<char>* buf, bool modified_only);
+
+// Settings (disk)
+static bool             IniBinaryIsValidHeader(const char* data, size_t data_size);
+static void             IniBinaryReadRecords(const char* data, size_t data_size, ImGuiTextBuffer* out_text_buf);
+static void             SaveIniSettingsToDiskBinary(const char* ini_filename, bool async);
+static void             SaveIniSettingsToDiskEx(const char* ini_filename, bool async);
+static bool             IniWriteFile(const char* ini_filename, const char* ini_data, size_t ini_data_size, size_t append_offset, bool async);
+static void             IniWaitPendingWrite();
+
+// Logging
+static void             LogFlush(ImGuiContext& g);
 
 // Platform Dependents default implementation for IO functions
 static const char*      GetClipboardTextFn_DefaultImpl(void* user_data);
 static void             SetClipboardTextFn_DefaultImpl(void* user_data, const char* text);
 static void             ImeSetInputScreenPosFn_DefaultImpl(int x, int y);
 
+// Frame profiler
+#ifdef IMGUI_ENABLE_PROFILER
+static ImU64            ProfilerGetClockFrequency();
+static void             ProfilerContextHook(ImGuiContext* ctx, ImGuiContextHook* hook);
+static void             ProfilerTraceFinishEx(ImGuiContext* ctx);
+#endif
+
 namespace ImGui
 {
 // Navigation
@@ -918,6 +953,7 @@ static void             ErrorCheckEndFrameSanityChecks();
 
 // Misc
 static void             UpdateSettings();
+static void             UpdateInputEvents(bool trickle_fast_inputs);
 static void             UpdateMouseInputs();
 static void             UpdateMouseWheel();
 static void             UpdateTabFocus();
@@ -948,7 +984,11 @@ static void             UpdateViewportsNewFrame();
 //   Change to a different context by calling ImGui::SetCurrentContext().
 // - Important: Dear ImGui functions are not thread-safe because of this pointer.
 //   If you want thread-safety to allow N threads to access N different contexts:
-//   - Change this variable to use thread local storage so each thread can refer to a different context, in your imconfig.h:
+//   - Make this variable use thread local storage so each thread can refer to a different context, in your imconfig.h:
+//         #define IMGUI_USE_THREAD_LOCAL_CONTEXT
+//     Contexts don't share any other mutable state: a font atlas shared between contexts (see CreateContext()) is only read
+//     by them, so it needs to be built before and not modified while other threads are using it.
+//   - Alternatively you can provide your own thread local variable, in your imconfig.h:
 //         struct ImGuiContext;
 //         extern thread_local ImGuiContext* MyImGuiTLS;
 //         #define GImGui MyImGuiTLS
@@ -957,7 +997,7 @@ static void             UpdateViewportsNewFrame();
 //   - If you need a finite number of contexts, you may compile and use multiple instances of the ImGui code from a different namespace.
 // - DLL users: read comments above.
 #ifndef GImGui
-ImGuiContext*   GImGui = NULL;
+IM_THREAD_LOCAL ImGuiContext*   GImGui = NULL;
 #endif
 
 // Memory Allocator functions. Use SetAllocatorFunctions() to change them.
@@ -1067,6 +1107,7 @@ ImGuiIO::ImGuiIO()
     IniSavingRate = 5.0f;
     IniFilename = "imgui.ini";
     LogFilename = "imgui_log.txt";
+    IniSavingBinary = false;
     MouseDoubleClickTime = 0.30f;
     MouseDoubleClickMaxDist = 6.0f;
     for (int i = 0; i < ImGuiKey_COUNT; i++)
@@ -1092,6 +1133,8 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigMemoryCompactBudget = 0;
+    ConfigInputTrickleEventQueue = true;
 
     // Platform Functions
     BackendPlatformName = BackendRendererName = NULL;
@@ -1111,13 +1154,70 @@ ImGuiIO::ImGuiIO()
     for (int i = 0; i < IM_ARRAYSIZE(NavInputsDownDuration); i++) NavInputsDownDuration[i] = -1.0f;
 }
 
+// Input events are queued into the context which owns this ImGuiIO (not necessarily the current one), and applied in order by NewFrame().
+static ImGuiInputEvent* AddInputEvent(ImGuiIO* io, ImGuiInputEventType type)
+{
+    IM_ASSERT(io->Ctx != NULL && "Can only add events to the io of a context, e.g. ImGui::GetIO().");
+    ImGuiContext& g = *io->Ctx;
+    g.InputEventsQueue.push_back(ImGuiInputEvent());
+    ImGuiInputEvent* e = &g.InputEventsQueue.back();
+    e->Type = type;
+    return e;
+}
+
+void ImGuiIO::AddMousePosEvent(float x, float y)
+{
+    ImGuiInputEvent* e = AddInputEvent(this, ImGuiInputEventType_MousePos);
+    e->MousePos.PosX = x;
+    e->MousePos.PosY = y;
+}
+
+void ImGuiIO::AddMouseButtonEvent(int button, bool down)
+{
+    IM_ASSERT(button >= 0 && button < IM_ARRAYSIZE(MouseDown));
+    ImGuiInputEvent* e = AddInputEvent(this, ImGuiInputEventType_MouseButton);
+    e->MouseButton.Button = button;
+    e->MouseButton.Down = down;
+}
+
+void ImGuiIO::AddMouseWheelEvent(float wh_x, float wh_y)
+{
+    if (wh_x == 0.0f && wh_y == 0.0f)
+        return;
+    ImGuiInputEvent* e = AddInputEvent(this, ImGuiInputEventType_MouseWheel);
+    e->MouseWheel.WheelX = wh_x;
+    e->MouseWheel.WheelY = wh_y;
+}
+
+void ImGuiIO::AddKeyEvent(int key_index, bool down)
+{
+    IM_ASSERT(key_index >= 0 && key_index < IM_ARRAYSIZE(KeysDown));
+    ImGuiInputEvent* e = AddInputEvent(this, ImGuiInputEventType_Key);
+    e->Key.Key = key_index;
+    e->Key.Down = down;
+}
+
+void ImGuiIO::AddKeyModsEvent(ImGuiKeyModFlags mods)
+{
+    ImGuiInputEvent* e = AddInputEvent(this, ImGuiInputEventType_KeyMods);
+    e->KeyMods.Mods = mods;
+}
+
 // Pass in translated ASCII characters for text input.
 // - with glfw you can get those from the callback set in glfwSetCharCallback()
 // - on Windows you can get those using ToAscii+keyboard state, or via the WM_CHAR message
 void ImGuiIO::AddInputCharacter(unsigned int c)
 {
-    if (c != 0)
-        InputQueueCharacters.push_back(c <= IM_UNICODE_CODEPOINT_MAX ? (ImWchar)c : IM_UNICODE_CODEPOINT_INVALID);
+    if (c == 0)
+        return;
+    const unsigned int ch = (c <= IM_UNICODE_CODEPOINT_MAX) ? c : IM_UNICODE_CODEPOINT_INVALID;
+    if (Ctx == NULL)
+    {
+        InputQueueCharacters.push_back((ImWchar)ch);
+        return;
+    }
+    ImGuiInputEvent* e = AddInputEvent(this, ImGuiInputEventType_Char);
+    e->Char.Char = ch;
 }
 
 // UTF16 strings use surrogate pairs to encode codepoints >= 0x10000, so
@@ -1130,7 +1230,7 @@ void ImGuiIO::AddInputCharacterUTF16(ImWchar16 c)
     if ((c & 0xFC00) == 0xD800) // High surrogate, must save
     {
         if (InputQueueSurrogate != 0)
-            InputQueueCharacters.push_back(IM_UNICODE_CODEPOINT_INVALID);
+            AddInputCharacter(IM_UNICODE_CODEPOINT_INVALID);
         InputQueueSurrogate = c;
         return;
     }
@@ -1140,7 +1240,7 @@ void ImGuiIO::AddInputCharacterUTF16(ImWchar16 c)
     {
         if ((c & 0xFC00) != 0xDC00) // Invalid low surrogate
         {
-            InputQueueCharacters.push_back(IM_UNICODE_CODEPOINT_INVALID);
+            AddInputCharacter(IM_UNICODE_CODEPOINT_INVALID);
         }
         else
         {
@@ -1153,7 +1253,7 @@ void ImGuiIO::AddInputCharacterUTF16(ImWchar16 c)
 
         InputQueueSurrogate = 0;
     }
-    InputQueueCharacters.push_back(cp);
+    AddInputCharacter((unsigned int)cp);
 }
 
 void ImGuiIO::AddInputCharactersUTF8(const char* utf8_chars)
@@ -1162,14 +1262,22 @@ void ImGuiIO::AddInputCharactersUTF8(const char* utf8_chars)
     {
         unsigned int c = 0;
         utf8_chars += ImTextCharFromUtf8(&c, utf8_chars, NULL);
-        if (c != 0)
-            InputQueueCharacters.push_back((ImWchar)c);
+        AddInputCharacter(c);
     }
 }
 
+// Also discard characters which are still queued for the next frames
 void ImGuiIO::ClearInputCharacters()
 {
     InputQueueCharacters.resize(0);
+    if (Ctx == NULL)
+        return;
+    ImVector<ImGuiInputEvent>& events = Ctx->InputEventsQueue;
+    ImGuiInputEvent* dst = events.Data;
+    for (const ImGuiInputEvent* src = events.Data; src < events.Data + events.Size; src++)
+        if (src->Type != ImGuiInputEventType_Char)
+            *dst++ = *src;
+    events.resize((int)(dst - events.Data));
 }
 
 //-----------------------------------------------------------------------------
@@ -1414,6 +1522,16 @@ const char* ImStrSkipBlank(const char* str)
     return str;
 }
 
+// On some platform vsnprintf() takes va_list by reference and modifies it.
+// va_copy is the 'correct' way to copy a va_list but Visual Studio prior to 2013 doesn't have it.
+#ifndef va_copy
+#if defined(__GNUC__) || defined(__clang__)
+#define va_copy(dest, src) __builtin_va_copy(dest, src)
+#else
+#define va_copy(dest, src) (dest = src)
+#endif
+#endif
+
 // A) MSVC version appears to return -1 on overflow, whereas glibc appears to return total count (which may be >= buf_size).
 // Ideally we would test for only one of those limits at runtime depending on the behavior the vsnprintf(), but trying to deduct it at compile time sounds like a pandora can of worm.
 // B) When buf==NULL vsnprintf() will return the output size.
@@ -1421,8 +1539,7 @@ const char* ImStrSkipBlank(const char* str)
 
 // We support stb_sprintf which is much faster (see: https://github.com/nothings/stb/blob/master/stb_sprintf.h)
 // You may set IMGUI_USE_STB_SPRINTF to use our default wrapper, or set IMGUI_DISABLE_DEFAULT_FORMAT_FUNCTIONS
-// and setup the wrapper yourself. (FIXME-OPT: Some of our high-level operations such as ImGuiTextBuffer::appendfv() are
-// designed using two-passes worst case, which probably could be improved using the stbsp_vsprintfcb() function.)
+// and setup the wrapper yourself.
 #ifdef IMGUI_USE_STB_SPRINTF
 #define STB_SPRINTF_IMPLEMENTATION
 #include "stb_sprintf.h"
@@ -1432,31 +1549,425 @@ const char* ImStrSkipBlank(const char* str)
 #define vsnprintf _vsnprintf
 #endif
 
+// Fast path for the most common format strings, tried by ImFormatString()/ImFormatStringV() before calling vsnprintf().
+// - Supports %d %i %u %x %X %c %s %f %F %g %G and %%, with '-', '+', ' ', '0' flags, width, precision (floats only) and hh/h/l/ll/z (and I64 with MSVC) length modifiers.
+// - Output is identical to a correctly rounding printf() (e.g. glibc, MSVC 2019 16.2+) in a locale using '.' as decimal point: floating point
+//   values are rounded from their exact binary value (ties to even) using 64-bit integer arithmetic, without going through intermediate doubles.
+// - Anything else (e.g. %e, '#' flag, '*' width, large values with %f, very large/small values with %g, NaN/Inf) makes it return -1
+//   before completing, in which case vsnprintf() is called with a copy of the original arguments.
+struct ImFormatSpec
+{
+    char        Conversion;     // 'd', 'u', 'x', 'X', 'c', 's', 'f', 'g', 'G'
+    char        Length;         // 0, 'H' (hh), 'h', 'l', 'L' (ll/I64), 'z'
+    bool        LeftAlign;      // '-'
+    bool        ZeroPad;        // '0'
+    bool        PlusSign;       // '+'
+    bool        SpaceSign;      // ' '
+    int         Width;
+    int         Precision;      // -1 when not specified
+};
+
+struct ImFormatWriter
+{
+    char*       Out;
+    char*       OutEnd;         // Last writable character, kept for the zero-terminator
+    int         Count;          // Number of characters that would have been written, like vsnprintf()
+
+    void        Put(char c)                     { if (Out < OutEnd) *Out++ = c; Count++; }
+    void        Put(const char* s, int len)     { const int n = ImMin(len, (int)(OutEnd - Out)); if (n > 0) { memcpy(Out, s, (size_t)n); Out += n; } Count += len; }
+    void        Fill(char c, int len)           { const int n = ImMin(len, (int)(OutEnd - Out)); if (n > 0) { memset(Out, c, (size_t)n); Out += n; } Count += ImMax(len, 0); }
+};
+
+static const char   IM_FORMAT_DIGIT_PAIRS[] = "00010203040506070809101112131415161718192021222324252627282930313233343536373839404142434445464748495051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+static const ImU64  IM_FORMAT_POW10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000, (ImU64)1000000000 * 10, (ImU64)1000000000 * 100, (ImU64)1000000000 * 1000, (ImU64)1000000000 * 10000, (ImU64)1000000000 * 100000, (ImU64)1000000000 * 1000000, (ImU64)1000000000 * 10000000, (ImU64)1000000000 * 100000000 };
+static const ImU32  IM_FORMAT_POW5[] = { 1u, 5u, 25u, 125u, 625u, 3125u, 15625u, 78125u, 390625u, 1953125u, 9765625u, 48828125u, 244140625u, 1220703125u };
+
+// Parse a conversion specification following a '%'. Return NULL if it is not supported by the fast path.
+static const char* ImFormatParseSpec(const char* fmt, ImFormatSpec* spec)
+{
+    memset(spec, 0, sizeof(*spec));
+    spec->Precision = -1;
+    for (;; fmt++)
+    {
+        if (*fmt == '-')        spec->LeftAlign = true;
+        else if (*fmt == '0')   spec->ZeroPad = true;
+        else if (*fmt == '+')   spec->PlusSign = true;
+        else if (*fmt == ' ')   spec->SpaceSign = true;
+        else                    break;
+    }
+    for (; *fmt >= '0' && *fmt <= '9'; fmt++)
+        if ((spec->Width = spec->Width * 10 + (*fmt - '0')) > 1024)
+            return NULL;
+    if (*fmt == '.')
+        for (spec->Precision = 0, fmt++; *fmt >= '0' && *fmt <= '9'; fmt++)
+            if ((spec->Precision = spec->Precision * 10 + (*fmt - '0')) > 17)
+                return NULL;
+    if (fmt[0] == 'h')                                          { spec->Length = (fmt[1] == 'h') ? 'H' : 'h'; fmt += (fmt[1] == 'h') ? 2 : 1; }
+    else if (fmt[0] == 'l')                                     { spec->Length = (fmt[1] == 'l') ? 'L' : 'l'; fmt += (fmt[1] == 'l') ? 2 : 1; }
+    else if (fmt[0] == 'z')                                     { spec->Length = 'z'; fmt++; }
+#ifdef _MSC_VER
+    else if (fmt[0] == 'I' && fmt[1] == '6' && fmt[2] == '4')   { spec->Length = 'L'; fmt += 3; } // glibc reads "%I64d" as the 'I' flag followed by a width
+#endif
+
+    const char c = *fmt++;
+    switch (c)
+    {
+    case 'd': case 'i':
+        spec->Conversion = 'd';
+        return (spec->Precision < 0 && spec->Length != 'z') ? fmt : NULL;
+    case 'u': case 'x': case 'X':
+        spec->Conversion = c;
+        return (spec->Precision < 0) ? fmt : NULL;
+    case 'c': case 's':
+        spec->Conversion = c;
+        return (spec->Precision < 0 && spec->Length == 0 && !spec->ZeroPad) ? fmt : NULL;
+    case 'f': case 'F': case 'g': case 'G':
+        spec->Conversion = (c == 'F') ? 'f' : c;
+        return (spec->Length == 0 || spec->Length == 'l') ? fmt : NULL;
+    }
+    return NULL;
+}
+
+// Write the decimal digits of 'v' backward from 'end', return a pointer to the first digit.
+static char* ImFormatDigitsBackward(char* end, ImU64 v)
+{
+    while (v >= 100)
+    {
+        const char* pair = &IM_FORMAT_DIGIT_PAIRS[(v % 100) * 2];
+        v /= 100;
+        *--end = pair[1];
+        *--end = pair[0];
+    }
+    if (v >= 10)
+    {
+        *--end = IM_FORMAT_DIGIT_PAIRS[v * 2 + 1];
+        *--end = IM_FORMAT_DIGIT_PAIRS[v * 2];
+    }
+    else
+    {
+        *--end = (char)('0' + v);
+    }
+    return end;
+}
+
+// Compute the exact value of 'v * 10^n' rounded to the nearest integer (ties to even), for 'v' finite and positive and 0 <= n <= 13.
+// As v = mantissa * 2^exp2 and 10^n = 5^n * 2^n, this is (mantissa * 5^n) * 2^(exp2 + n): a 85-bit product followed by a rounding shift.
+// Return false if the result doesn't fit in 63 bits.
+static bool ImFormatRoundScaled(double v, int n, ImU64* out)
+{
+    IM_ASSERT(n >= 0 && n < IM_ARRAYSIZE(IM_FORMAT_POW5));
+    ImU64 bits;
+    memcpy(&bits, &v, sizeof(bits));
+    const int biased_exp = (int)(bits >> 52) & 0x7FF;
+    ImU64 mantissa = bits & (((ImU64)1 << 52) - 1);
+    int shift = (biased_exp == 0) ? (-1074 + n) : (biased_exp - 1075 + n);
+    if (biased_exp != 0)
+        mantissa |= ((ImU64)1 << 52);
+
+    // 128-bit product (hi, lo) = mantissa * 5^n
+    const ImU64 pow5 = IM_FORMAT_POW5[n];
+    const ImU64 prod_lo = (mantissa & 0xFFFFFFFF) * pow5;
+    const ImU64 prod_hi = (mantissa >> 32) * pow5;
+    const ImU64 lo = prod_lo + (prod_hi << 32);
+    const ImU64 hi = (prod_hi >> 32) + ((lo < prod_lo) ? 1 : 0);
+    if (shift >= 0)
+    {
+        if (hi != 0 || shift >= 63 || (lo >> (63 - shift)) != 0)
+            return false;
+        *out = lo << shift;
+        return true;
+    }
+
+    // Shift right, rounding to nearest, ties to even
+    shift = -shift;
+    if (shift > 86)
+    {
+        *out = 0; // Product is < 2^85, so less than half
+        return true;
+    }
+    ImU64 q, half_bit, below_half;
+    if (shift < 64)
+    {
+        if ((hi >> shift) != 0)
+            return false;
+        q = (lo >> shift) | (hi << (64 - shift));
+        half_bit = (lo >> (shift - 1)) & 1;
+        below_half = (shift > 1) ? (lo & (((ImU64)1 << (shift - 1)) - 1)) : 0;
+    }
+    else if (shift == 64)
+    {
+        q = hi;
+        half_bit = lo >> 63;
+        below_half = lo & (((ImU64)1 << 63) - 1);
+    }
+    else
+    {
+        q = hi >> (shift - 64);
+        half_bit = (hi >> (shift - 65)) & 1;
+        below_half = lo | ((shift > 65) ? (hi & (((ImU64)1 << (shift - 65)) - 1)) : 0);
+    }
+    if (half_bit && (below_half != 0 || (q & 1)))
+        q++;
+    *out = q;
+    return (q >> 63) == 0;
+}
+
+// Format a positive finite double for %f, %g or %G. Return the number of characters written at 'out' (at most 40), or -1 if unsupported.
+static int ImFormatDouble(char* out, double v, char conversion, int precision)
+{
+    char digits[24];
+    char* const digits_end = digits + IM_ARRAYSIZE(digits);
+    if (conversion == 'f')
+    {
+        if (precision < 0)
+            precision = 6;
+        ImU64 q;
+        if (precision >= IM_ARRAYSIZE(IM_FORMAT_POW5) || !ImFormatRoundScaled(v, precision, &q))
+            return -1;
+        // Split digits of 'q' into integer and fractional parts, padding with zeros on the left
+        char* q_digits = ImFormatDigitsBackward(digits_end, q);
+        while (digits_end - q_digits <= precision)
+            *--q_digits = '0';
+        char* p = out;
+        const int int_count = (int)(digits_end - q_digits) - precision;
+        memcpy(p, q_digits, (size_t)int_count);
+        p += int_count;
+        if (precision > 0)
+        {
+            *p++ = '.';
+            memcpy(p, q_digits + int_count, (size_t)precision);
+            p += precision;
+        }
+        return (int)(p - out);
+    }
+
+    // %g: 'precision' significant digits, in exponent form if the decimal exponent X < -4 or X >= precision, trailing zeros removed
+    if (precision < 0)
+        precision = 6;
+    else if (precision == 0)
+        precision = 1;
+    if (v == 0.0)
+    {
+        out[0] = '0';
+        return 1;
+    }
+    ImU64 bits;
+    memcpy(&bits, &v, sizeof(bits));
+    const int exp2 = (int)((bits >> 52) & 0x7FF) - 1023;
+    int exp10 = (exp2 >= 0) ? ((exp2 * 78913) >> 18) : -((-exp2 * 78913 + (1 << 18) - 1) >> 18); // floor(exp2 * log10(2)): equal to floor(log10(v)) or one less, corrected below
+    ImU64 q = 0;
+    for (int attempt = 0; ; attempt++)
+    {
+        const int n = precision - 1 - exp10;
+        if (attempt == 4 || n < 0 || n >= IM_ARRAYSIZE(IM_FORMAT_POW5) || !ImFormatRoundScaled(v, n, &q))
+            return -1;
+        if (q >= IM_FORMAT_POW10[precision])
+            exp10++;
+        else if (q < IM_FORMAT_POW10[precision - 1])
+            exp10--;
+        else
+            break;
+    }
+    const char* sig_digits = ImFormatDigitsBackward(digits_end, q);
+    int sig_count = precision;
+    while (sig_count > 1 && sig_digits[sig_count - 1] == '0')
+        sig_count--;
+    char* p = out;
+    if (exp10 < -4 || exp10 >= precision)
+    {
+        *p++ = sig_digits[0];
+        if (sig_count > 1)
+        {
+            *p++ = '.';
+            memcpy(p, sig_digits + 1, (size_t)(sig_count - 1));
+            p += sig_count - 1;
+        }
+        *p++ = (conversion == 'G') ? 'E' : 'e';
+        *p++ = (exp10 < 0) ? '-' : '+';
+        const int exp10_abs = (exp10 < 0) ? -exp10 : exp10;
+        if (exp10_abs < 10)
+            *p++ = '0';
+        const char* exp_digits = ImFormatDigitsBackward(digits_end, (ImU64)exp10_abs);
+        memcpy(p, exp_digits, (size_t)(digits_end - exp_digits));
+        p += digits_end - exp_digits;
+    }
+    else if (exp10 >= 0)
+    {
+        memcpy(p, sig_digits, (size_t)(exp10 + 1));
+        p += exp10 + 1;
+        if (sig_count > exp10 + 1)
+        {
+            *p++ = '.';
+            memcpy(p, sig_digits + exp10 + 1, (size_t)(sig_count - exp10 - 1));
+            p += sig_count - exp10 - 1;
+        }
+    }
+    else
+    {
+        *p++ = '0';
+        *p++ = '.';
+        for (int n = exp10 + 1; n < 0; n++)
+            *p++ = '0';
+        memcpy(p, sig_digits, (size_t)sig_count);
+        p += sig_count;
+    }
+    return (int)(p - out);
+}
+
+// Output a field made of an optional sign character and 'body', padded to the field width.
+static void ImFormatWriteField(ImFormatWriter* w, const ImFormatSpec& spec, char sign, const char* body, int body_len)
+{
+    const int pad = spec.Width - body_len - (sign ? 1 : 0);
+    const bool zero_pad = spec.ZeroPad && !spec.LeftAlign;
+    if (!spec.LeftAlign && !zero_pad)
+        w->Fill(' ', pad);
+    if (sign)
+        w->Put(sign);
+    if (zero_pad)
+        w->Fill('0', pad);
+    w->Put(body, body_len);
+    if (spec.LeftAlign)
+        w->Fill(' ', pad);
+}
+
+// Return the number of characters that would have been written (like vsnprintf), or -1 if the format string needs to be handled by vsnprintf().
+static int ImFormatStringFastV(char* buf, size_t buf_size, const char* fmt, va_list args)
+{
+    ImFormatWriter w;
+    w.Out = buf;
+    w.OutEnd = buf ? buf + buf_size - 1 : NULL;
+    w.Count = 0;
+    bool locale_checked = false;
+    while (*fmt)
+    {
+        const char* fmt_literal_end = fmt;
+        while (*fmt_literal_end && *fmt_literal_end != '%')
+            fmt_literal_end++;
+        w.Put(fmt, (int)(fmt_literal_end - fmt));
+        fmt = fmt_literal_end;
+        if (*fmt == 0)
+            break;
+        if (fmt[1] == '%')
+        {
+            w.Put('%');
+            fmt += 2;
+            continue;
+        }
+
+        ImFormatSpec spec;
+        fmt = ImFormatParseSpec(fmt + 1, &spec);
+        if (fmt == NULL)
+            return -1;
+
+        char body[64];
+        char* const body_end = body + IM_ARRAYSIZE(body);
+        switch (spec.Conversion)
+        {
+        case 'd':
+        {
+            ImS64 v;
+            switch (spec.Length)
+            {
+            case 'H':   v = (signed char)va_arg(args, int); break;
+            case 'h':   v = (short)va_arg(args, int); break;
+            case 'l':   v = va_arg(args, long); break;
+            case 'L':   v = va_arg(args, ImS64); break;
+            default:    v = va_arg(args, int); break;
+            }
+            const char* digits = ImFormatDigitsBackward(body_end, (v < 0) ? (ImU64)0 - (ImU64)v : (ImU64)v);
+            ImFormatWriteField(&w, spec, (v < 0) ? '-' : spec.PlusSign ? '+' : spec.SpaceSign ? ' ' : 0, digits, (int)(body_end - digits));
+            break;
+        }
+        case 'u': case 'x': case 'X':
+        {
+            ImU64 v;
+            switch (spec.Length)
+            {
+            case 'H':   v = (unsigned char)va_arg(args, unsigned int); break;
+            case 'h':   v = (unsigned short)va_arg(args, unsigned int); break;
+            case 'l':   v = va_arg(args, unsigned long); break;
+            case 'L':   v = va_arg(args, ImU64); break;
+            case 'z':   v = va_arg(args, size_t); break;
+            default:    v = va_arg(args, unsigned int); break;
+            }
+            const char* digits;
+            if (spec.Conversion == 'u')
+            {
+                digits = ImFormatDigitsBackward(body_end, v);
+            }
+            else
+            {
+                const char* hex_digits = (spec.Conversion == 'X') ? "0123456789ABCDEF" : "0123456789abcdef";
+                char* p = body_end;
+                do { *--p = hex_digits[v & 15]; v >>= 4; } while (v != 0);
+                digits = p;
+            }
+            ImFormatWriteField(&w, spec, 0, digits, (int)(body_end - digits));
+            break;
+        }
+        case 'c':
+        {
+            const char c = (char)va_arg(args, int);
+            ImFormatWriteField(&w, spec, 0, &c, 1);
+            break;
+        }
+        case 's':
+        {
+            const char* str = va_arg(args, const char*);
+            if (str == NULL)
+                return -1;
+            ImFormatWriteField(&w, spec, 0, str, (int)strlen(str));
+            break;
+        }
+        default: // 'f', 'g', 'G'
+        {
+            if (!locale_checked)
+            {
+                const char* decimal_point = localeconv()->decimal_point;
+                if (decimal_point[0] != '.' || decimal_point[1] != 0)
+                    return -1;
+                locale_checked = true;
+            }
+            const double v = va_arg(args, double);
+            ImU64 bits;
+            memcpy(&bits, &v, sizeof(bits));
+            if (((bits >> 52) & 0x7FF) == 0x7FF) // NaN or Inf
+                return -1;
+            const bool negative = (bits >> 63) != 0;
+            const int body_len = ImFormatDouble(body, negative ? -v : v, spec.Conversion, spec.Precision);
+            if (body_len < 0)
+                return -1;
+            ImFormatWriteField(&w, spec, negative ? '-' : spec.PlusSign ? '+' : spec.SpaceSign ? ' ' : 0, body, body_len);
+            break;
+        }
+        }
+    }
+    return w.Count;
+}
+
 int ImFormatString(char* buf, size_t buf_size, const char* fmt, ...)
 {
     va_list args;
     va_start(args, fmt);
-#ifdef IMGUI_USE_STB_SPRINTF
-    int w = stbsp_vsnprintf(buf, (int)buf_size, fmt, args);
-#else
-    int w = vsnprintf(buf, buf_size, fmt, args);
-#endif
+    int w = ImFormatStringV(buf, buf_size, fmt, args);
     va_end(args);
-    if (buf == NULL)
-        return w;
-    if (w == -1 || w >= (int)buf_size)
-        w = (int)buf_size - 1;
-    buf[w] = 0;
     return w;
 }
 
 int ImFormatStringV(char* buf, size_t buf_size, const char* fmt, va_list args)
 {
+    va_list args_copy;
+    va_copy(args_copy, args);
+    int w = ImFormatStringFastV(buf, buf_size, fmt, args_copy);
+    va_end(args_copy);
+    if (w < 0)
+    {
 #ifdef IMGUI_USE_STB_SPRINTF
-    int w = stbsp_vsnprintf(buf, (int)buf_size, fmt, args);
+        w = stbsp_vsnprintf(buf, (int)buf_size, fmt, args);
 #else
-    int w = vsnprintf(buf, buf_size, fmt, args);
+        w = vsnprintf(buf, buf_size, fmt, args);
 #endif
+    }
     if (buf == NULL)
         return w;
     if (w == -1 || w >= (int)buf_size)
@@ -1464,6 +1975,24 @@ int ImFormatStringV(char* buf, size_t buf_size, const char* fmt, va_list args)
     buf[w] = 0;
     return w;
 }
+
+// Round 'v' to 'precision' decimals, with the same result as formatting it with "%.<precision>f" using ImFormatString() then reading it back with ImAtof().
+// ImFormatRoundScaled() gives the exact decimal digits 'q' that would be printed, and a single division q / 10^precision rounds to the nearest double
+// exactly like a correct ImAtof() would, provided both operands are exactly representable as doubles. Return false when we can't guarantee that.
+bool ImFormatRoundDouble(double v, int precision, double* out)
+{
+    if (v == 0.0) // Keep sign of zero
+    {
+        *out = v;
+        return true;
+    }
+    ImU64 q;
+    if (precision < 0 || precision >= IM_ARRAYSIZE(IM_FORMAT_POW5) || !ImFormatRoundScaled((v < 0.0) ? -v : v, precision, &q) || q >= ((ImU64)1 << 53))
+        return false;
+    const double r = (double)q / (double)IM_FORMAT_POW10[precision];
+    *out = (v < 0.0) ? -r : r;
+    return true;
+}
 #endif // #ifdef IMGUI_DISABLE_DEFAULT_FORMAT_FUNCTIONS
 
 // CRC32 needs a 1KB lookup table (not cache friendly)
@@ -1548,13 +2077,19 @@ ImFileHandle ImFileOpen(const char* filename, const char* mode)
 #if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS) && !defined(__CYGWIN__) && !defined(__GNUC__)
     // We need a fopen() wrapper because MSVC/Windows fopen doesn't handle UTF-8 filenames.
     // Previously we used ImTextCountCharsFromUtf8/ImTextStrFromUtf8 here but we now need to support ImWchar16 and ImWchar32!
+    // Don't use ImVector<> or IM_ALLOC() here: this may be called from a worker thread (e.g. io.IniWriteAsyncFn) and shouldn't access the context.
     const int filename_wsize = ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, NULL, 0);
     const int mode_wsize = ::MultiByteToWideChar(CP_UTF8, 0, mode, -1, NULL, 0);
-    ImVector<ImWchar> buf;
-    buf.resize(filename_wsize + mode_wsize);
-    ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, (wchar_t*)&buf[0], filename_wsize);
-    ::MultiByteToWideChar(CP_UTF8, 0, mode, -1, (wchar_t*)&buf[filename_wsize], mode_wsize);
-    return ::_wfopen((const wchar_t*)&buf[0], (const wchar_t*)&buf[filename_wsize]);
+    wchar_t local_buf[MAX_PATH + 8];
+    wchar_t* buf = (filename_wsize + mode_wsize <= IM_ARRAYSIZE(local_buf)) ? local_buf : (wchar_t*)malloc(sizeof(wchar_t) * (filename_wsize + mode_wsize));
+    if (buf == NULL)
+        return NULL;
+    ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, buf, filename_wsize);
+    ::MultiByteToWideChar(CP_UTF8, 0, mode, -1, buf + filename_wsize, mode_wsize);
+    ImFileHandle f = ::_wfopen(buf, buf + filename_wsize);
+    if (buf != local_buf)
+        free(buf);
+    return f;
 #else
     return fopen(filename, mode);
 #endif
@@ -1565,6 +2100,32 @@ bool    ImFileClose(ImFileHandle f)     { return fclose(f) == 0; }
 ImU64   ImFileGetSize(ImFileHandle f)   { long off = 0, sz = 0; return ((off = ftell(f)) != -1 && !fseek(f, 0, SEEK_END) && (sz = ftell(f)) != -1 && !fseek(f, off, SEEK_SET)) ? (ImU64)sz : (ImU64)-1; }
 ImU64   ImFileRead(void* data, ImU64 sz, ImU64 count, ImFileHandle f)           { return fread(data, (size_t)sz, (size_t)count, f); }
 ImU64   ImFileWrite(const void* data, ImU64 sz, ImU64 count, ImFileHandle f)    { return fwrite(data, (size_t)sz, (size_t)count, f); }
+
+// Rename a file, replacing destination if it exists
+bool    ImFileRename(const char* src_filename, const char* dst_filename)
+{
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS) && !defined(__CYGWIN__) && !defined(__GNUC__)
+    // We need a MoveFileExW() wrapper because rename() doesn't replace an existing file on Windows, and doesn't handle UTF-8 filenames.
+    // Same as ImFileOpen(): no ImVector<> or IM_ALLOC() as this may be called from a worker thread.
+    const int src_wsize = ::MultiByteToWideChar(CP_UTF8, 0, src_filename, -1, NULL, 0);
+    const int dst_wsize = ::MultiByteToWideChar(CP_UTF8, 0, dst_filename, -1, NULL, 0);
+    wchar_t local_buf[MAX_PATH * 2];
+    wchar_t* buf = (src_wsize + dst_wsize <= IM_ARRAYSIZE(local_buf)) ? local_buf : (wchar_t*)malloc(sizeof(wchar_t) * (src_wsize + dst_wsize));
+    if (buf == NULL)
+        return false;
+    ::MultiByteToWideChar(CP_UTF8, 0, src_filename, -1, buf, src_wsize);
+    ::MultiByteToWideChar(CP_UTF8, 0, dst_filename, -1, buf + src_wsize, dst_wsize);
+    const bool ret = ::MoveFileExW(buf, buf + src_wsize, MOVEFILE_REPLACE_EXISTING) != 0;
+    if (buf != local_buf)
+        free(buf);
+    return ret;
+#else
+#ifdef _WIN32
+    remove(dst_filename);
+#endif
+    return rename(src_filename, dst_filename) == 0;
+#endif
+}
 #endif // #ifndef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
 
 // Helper: Load file content into memory
@@ -2030,6 +2591,10 @@ void ImGuiStorage::SetAllInt(int v)
 // Helper: Parse and apply text filters. In format "aaaaa[,bbbb][,ccccc]"
 ImGuiTextFilter::ImGuiTextFilter(const char* default_filter)
 {
+    CacheItems = NULL;
+    CacheItemsCount = 0;
+    FuzzyItems = NULL;
+    FuzzyItemsCount = FuzzyItemsDone = FuzzyMaxResults = 0;
     if (default_filter)
     {
         ImStrncpy(InputBuf, default_filter, IM_ARRAYSIZE(InputBuf));
@@ -2049,6 +2614,16 @@ bool ImGuiTextFilter::Draw(const char* label, float width)
     bool value_changed = ImGui::InputText(label, InputBuf, IM_ARRAYSIZE(InputBuf));
     if (value_changed)
         Build();
+
+    // Display progress of a FuzzySearch() spread over multiple frames, along the bottom of the input frame
+    if (IsFuzzySearching())
+    {
+        ImVec2 bar_min = ImGui::GetItemRectMin();
+        ImVec2 bar_max = ImGui::GetItemRectMax();
+        bar_min.y = ImMax(bar_min.y, bar_max.y - 2.0f);
+        bar_max.x = ImLerp(bar_min.x, bar_max.x, GetFuzzyProgress());
+        ImGui::GetWindowDrawList()->AddRectFilled(bar_min, bar_max, ImGui::GetColorU32(ImGuiCol_PlotHistogram));
+    }
     return value_changed;
 }
 
@@ -2125,76 +2700,425 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
     return false;
 }
 
-//-----------------------------------------------------------------------------
-// [SECTION] ImGuiTextBuffer
-//-----------------------------------------------------------------------------
+// Filter terms prepared for batch matching: uppercase copies of the needles, in the same order as Filters[]
+struct ImGuiTextFilterTerms
+{
+    char        Buf[256];
+    int         Offset[128];    // Offset of needle in Buf[], needle is empty (never matches) when Len == 0
+    int         Len[128];
+    bool        Exclude[128];
+    int         Count;
+    int         CountGrep;
 
-// On some platform vsnprintf() takes va_list by reference and modifies it.
-// va_copy is the 'correct' way to copy a va_list but Visual Studio prior to 2013 doesn't have it.
-#ifndef va_copy
-#if defined(__GNUC__) || defined(__clang__)
-#define va_copy(dest, src) __builtin_va_copy(dest, src)
-#else
-#define va_copy(dest, src) (dest = src)
-#endif
-#endif
+    ImGuiTextFilterTerms(const ImGuiTextFilter& filter)
+    {
+        // Filters[] are all ranges of InputBuf[] split by ',' so the total size and count are bounded by IM_ARRAYSIZE(InputBuf)
+        int buf_size = 0;
+        Count = 0;
+        CountGrep = filter.CountGrep;
+        for (int i = 0; i != filter.Filters.Size; i++)
+        {
+            const ImGuiTextFilter::ImGuiTextRange& f = filter.Filters[i];
+            if (f.empty())
+                continue;
+            const char* needle = (f.b[0] == '-') ? f.b + 1 : f.b;
+            Exclude[Count] = (f.b[0] == '-');
+            Offset[Count] = buf_size;
+            Len[Count] = (int)(f.e - needle);
+            for (const char* c = needle; c < f.e; c++)
+                Buf[buf_size++] = (*c >= 'a' && *c <= 'z') ? *c - 'a' + 'A' : *c;
+            Count++;
+        }
+    }
+};
 
-char ImGuiTextBuffer::EmptyString[1] = { 0 };
+static inline char ImToUpperAscii(char c)
+{
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+}
 
-void ImGuiTextBuffer::append(const char* str, const char* str_end)
+#ifdef IMGUI_ENABLE_SSE2
+static inline __m128i ImToUpperAscii16(__m128i v)
 {
-    int len = str_end ? (int)(str_end - str) : (int)strlen(str);
+    const __m128i is_lower = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('z' + 1)));
+    return _mm_sub_epi8(v, _mm_and_si128(is_lower, _mm_set1_epi8('a' - 'A')));
+}
+#endif
 
-    // Add zero-terminator the first time
-    const int write_off = (Buf.Size != 0) ? Buf.Size : 1;
-    const int needed_sz = write_off + len;
-    if (write_off + len >= Buf.Capacity)
+// Case-insensitive (ASCII-only) substring search for an uppercase needle. Same results as ImStristr() in the "C" locale.
+// With SSE2, compare first and last characters of the needle at 16 positions at once, and only verify candidates positions.
+static bool ImStristrUpperNeedle(const char* haystack, const char* haystack_end, const char* needle, int needle_len)
+{
+    if (needle_len == 0 || haystack_end - haystack < needle_len)
+        return false;
+    const char* p = haystack;
+    const char* p_last = haystack_end - needle_len; // Last possible match position
+#ifdef IMGUI_ENABLE_SSE2
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last = _mm_set1_epi8(needle[needle_len - 1]);
+    for (; p + 16 <= p_last + 1; p += 16)
+    {
+        const __m128i block_first = ImToUpperAscii16(_mm_loadu_si128((const __m128i*)(const void*)p));
+        const __m128i block_last = ImToUpperAscii16(_mm_loadu_si128((const __m128i*)(const void*)(p + needle_len - 1)));
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, block_first), _mm_cmpeq_epi8(last, block_last)));
+        while (mask != 0)
+        {
+            int bit_n = 0;
+            while (!(mask & (1u << bit_n)))
+                bit_n++;
+            const char* candidate = p + bit_n;
+            int n = 1;
+            while (n < needle_len - 1 && ImToUpperAscii(candidate[n]) == needle[n])
+                n++;
+            if (n >= needle_len - 1)
+                return true;
+            mask &= mask - 1;
+        }
+    }
+#endif
+    for (; p <= p_last; p++)
     {
-        int new_capacity = Buf.Capacity * 2;
-        Buf.reserve(needed_sz > new_capacity ? needed_sz : new_capacity);
+        int n = 0;
+        while (n < needle_len && ImToUpperAscii(p[n]) == needle[n])
+            n++;
+        if (n == needle_len)
+            return true;
     }
+    return false;
+}
 
-    Buf.resize(needed_sz);
-    memcpy(&Buf[write_off - 1], str, (size_t)len);
-    Buf[write_off - 1 + len] = 0;
+// Same logic as PassFilter()
+static bool PassFilterTerms(const ImGuiTextFilterTerms& terms, const char* text)
+{
+    if (text == NULL)
+        text = "";
+    const char* text_end = text + strlen(text);
+    for (int i = 0; i != terms.Count; i++)
+        if (ImStristrUpperNeedle(text, text_end, terms.Buf + terms.Offset[i], terms.Len[i]))
+            return !terms.Exclude[i];
+    return terms.CountGrep == 0;
 }
 
-void ImGuiTextBuffer::appendf(const char* fmt, ...)
+void ImGuiTextFilter::PassFilterItems(const char* const* items, int items_count, bool* out_pass) const
 {
-    va_list args;
-    va_start(args, fmt);
-    appendfv(fmt, args);
-    va_end(args);
+    if (Filters.empty())
+    {
+        for (int n = 0; n < items_count; n++)
+            out_pass[n] = true;
+        return;
+    }
+    ImGuiTextFilterTerms terms(*this);
+    for (int n = 0; n < items_count; n++)
+        out_pass[n] = PassFilterTerms(terms, items[n]);
 }
 
-// Helper: Text buffer for logging/accumulating text
-void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
+// Return true if all items passing 'new_filter' would pass 'old_filter'. We make sure it is true with ordered terms semantic of PassFilter():
+// same count and kinds of terms, include terms can only grow (old one is a substring of new one) and exclude terms can only shrink.
+static bool TextFilterIsNarrowerThan(const ImGuiTextFilterTerms& new_terms, const ImGuiTextFilterTerms& old_terms)
 {
-    va_list args_copy;
-    va_copy(args_copy, args);
+    if (new_terms.Count != old_terms.Count || new_terms.CountGrep != old_terms.CountGrep)
+        return false;
+    for (int i = 0; i != new_terms.Count; i++)
+    {
+        if (new_terms.Exclude[i] != old_terms.Exclude[i])
+            return false;
+        const char* new_needle = new_terms.Buf + new_terms.Offset[i];
+        const char* old_needle = old_terms.Buf + old_terms.Offset[i];
+        if (new_terms.Exclude[i] ? !ImStristrUpperNeedle(old_needle, old_needle + old_terms.Len[i], new_needle, new_terms.Len[i]) : !ImStristrUpperNeedle(new_needle, new_needle + new_terms.Len[i], old_needle, old_terms.Len[i]))
+            return false;
+    }
+    return true;
+}
 
-    int len = ImFormatStringV(NULL, 0, fmt, args);         // FIXME-OPT: could do a first pass write attempt, likely successful on first pass.
-    if (len <= 0)
+const ImVector<int>& ImGuiTextFilter::FilterItems(const char* const* items, int items_count)
+{
+    const bool same_items = (CacheItems == items && CacheItemsCount == items_count && CacheInputBuf.Size > 0);
+    if (same_items && strcmp(CacheInputBuf.Data, InputBuf) == 0)
+        return CacheIndices;
+
+    ImGuiTextFilterTerms terms(*this);
+    bool narrowed = false;
+    if (same_items && !Filters.empty())
     {
-        va_end(args_copy);
-        return;
+        ImGuiTextFilter old_filter(CacheInputBuf.Data);
+        narrowed = TextFilterIsNarrowerThan(terms, ImGuiTextFilterTerms(old_filter));
     }
 
-    // Add zero-terminator the first time
-    const int write_off = (Buf.Size != 0) ? Buf.Size : 1;
-    const int needed_sz = write_off + len;
-    if (write_off + len >= Buf.Capacity)
+    if (narrowed)
     {
-        int new_capacity = Buf.Capacity * 2;
-        Buf.reserve(needed_sz > new_capacity ? needed_sz : new_capacity);
+        // Only test previous matches
+        int write_n = 0;
+        for (int read_n = 0; read_n < CacheIndices.Size; read_n++)
+            if (PassFilterTerms(terms, items[CacheIndices[read_n]]))
+                CacheIndices[write_n++] = CacheIndices[read_n];
+        CacheIndices.resize(write_n);
     }
+    else
+    {
+        CacheIndices.resize(items_count);
+        int write_n = 0;
+        for (int n = 0; n < items_count; n++)
+            if (Filters.empty() || PassFilterTerms(terms, items[n]))
+                CacheIndices[write_n++] = n;
+        CacheIndices.resize(write_n);
+    }
+
+    CacheItems = items;
+    CacheItemsCount = items_count;
+    const int input_len = (int)strlen(InputBuf);
+    CacheInputBuf.resize(input_len + 1);
+    memcpy(CacheInputBuf.Data, InputBuf, (size_t)input_len + 1);
+    return CacheIndices;
+}
+
+// Fuzzy matching: score a subsequence match of 'pattern' (uppercase, blanks removed) in 'text'.
+// - Forward scan finds the end of the first match, backward scan from there finds the shortest match ending there.
+// - Matched characters score more when consecutive or on a word boundary (start of text, after a separator, camelCase, digit), gaps are penalized.
+enum ImGuiTextFuzzyScore_
+{
+    ImGuiTextFuzzyScore_Match           = 16,
+    ImGuiTextFuzzyScore_BoundaryStart   = 10,
+    ImGuiTextFuzzyScore_BoundarySep     = 8,
+    ImGuiTextFuzzyScore_BoundaryCamel   = 7,
+    ImGuiTextFuzzyScore_Consecutive     = 4,
+    ImGuiTextFuzzyScore_GapStart        = -3,
+    ImGuiTextFuzzyScore_GapExtension    = -1,
+    ImGuiTextFuzzyScore_LeadingMax      = -10
+};
 
-    Buf.resize(needed_sz);
-    ImFormatStringV(&Buf[write_off - 1], (size_t)len + 1, fmt, args_copy);
-    va_end(args_copy);
+static inline bool ImCharIsFuzzySeparator(char c)
+{
+    return c == ' ' || c == '\t' || c == '_' || c == '-' || c == '.' || c == ',' || c == '/' || c == '\\' || c == ':' || c == '(' || c == '[';
 }
 
-//-----------------------------------------------------------------------------
+static bool FuzzyMatchScore(const char* pattern, int pattern_len, const char* text, int* out_score)
+{
+    IM_ASSERT(pattern_len > 0);
+    int pattern_n = 0;
+    const char* text_p = text;
+    for (; *text_p != 0; text_p++)
+        if (ImToUpperAscii(*text_p) == pattern[pattern_n] && ++pattern_n == pattern_len)
+            break;
+    if (pattern_n < pattern_len)
+        return false;
+    const char* match_end = text_p + 1;
+    const char* match_start = text_p;
+    for (pattern_n = pattern_len - 1; ; match_start--)
+        if (ImToUpperAscii(*match_start) == pattern[pattern_n] && pattern_n-- == 0)
+            break;
+
+    int score = ImMax((int)ImGuiTextFuzzyScore_LeadingMax, -(int)(match_start - text));
+    int gap = 0;
+    bool prev_matched = false;
+    pattern_n = 0;
+    for (const char* c = match_start; c < match_end; c++)
+    {
+        if (ImToUpperAscii(*c) != pattern[pattern_n])
+        {
+            score += (gap++ == 0) ? ImGuiTextFuzzyScore_GapStart : ImGuiTextFuzzyScore_GapExtension;
+            prev_matched = false;
+            continue;
+        }
+        const char prev_c = (c > text) ? c[-1] : 0;
+        score += ImGuiTextFuzzyScore_Match;
+        if (c == text)
+            score += ImGuiTextFuzzyScore_BoundaryStart;
+        else if (ImCharIsFuzzySeparator(prev_c))
+            score += ImGuiTextFuzzyScore_BoundarySep;
+        else if ((prev_c >= 'a' && prev_c <= 'z' && *c >= 'A' && *c <= 'Z') || (!(prev_c >= '0' && prev_c <= '9') && *c >= '0' && *c <= '9'))
+            score += ImGuiTextFuzzyScore_BoundaryCamel;
+        if (prev_matched)
+            score += ImGuiTextFuzzyScore_Consecutive;
+        prev_matched = true;
+        gap = 0;
+        pattern_n++;
+    }
+    *out_score = score;
+    return true;
+}
+
+// Return true if 'a' ranks below 'b'. On equal scores, the earlier item ranks first.
+static inline bool FuzzyResultIsWorse(const ImGuiTextFilter::ImGuiTextFuzzyResult& a, const ImGuiTextFilter::ImGuiTextFuzzyResult& b)
+{
+    return a.Score < b.Score || (a.Score == b.Score && a.Index > b.Index);
+}
+
+static int IMGUI_CDECL FuzzyResultComparer(const void* lhs, const void* rhs)
+{
+    const ImGuiTextFilter::ImGuiTextFuzzyResult* a = (const ImGuiTextFilter::ImGuiTextFuzzyResult*)lhs;
+    const ImGuiTextFilter::ImGuiTextFuzzyResult* b = (const ImGuiTextFilter::ImGuiTextFuzzyResult*)rhs;
+    return FuzzyResultIsWorse(*a, *b) ? +1 : FuzzyResultIsWorse(*b, *a) ? -1 : 0;
+}
+
+// Push into a min-heap of fixed capacity, replacing the worst result when full
+static void FuzzyHeapPush(ImVector<ImGuiTextFilter::ImGuiTextFuzzyResult>& heap, int heap_capacity, const ImGuiTextFilter::ImGuiTextFuzzyResult& result)
+{
+    int n;
+    if (heap.Size < heap_capacity)
+    {
+        // Sift up
+        heap.push_back(result);
+        for (n = heap.Size - 1; n > 0 && FuzzyResultIsWorse(result, heap[(n - 1) / 2]); n = (n - 1) / 2)
+            heap[n] = heap[(n - 1) / 2];
+        heap[n] = result;
+        return;
+    }
+    if (!FuzzyResultIsWorse(heap[0], result))
+        return;
+
+    // Sift down
+    for (n = 0; ; )
+    {
+        int child_n = n * 2 + 1;
+        if (child_n >= heap.Size)
+            break;
+        if (child_n + 1 < heap.Size && FuzzyResultIsWorse(heap[child_n + 1], heap[child_n]))
+            child_n++;
+        if (!FuzzyResultIsWorse(heap[child_n], result))
+            break;
+        heap[n] = heap[child_n];
+        n = child_n;
+    }
+    heap[n] = result;
+}
+
+bool ImGuiTextFilter::FuzzySearch(const char* const* items, int items_count, int max_results, int items_per_call)
+{
+    IM_ASSERT(max_results > 0);
+    const bool same_search = (FuzzyItems == items && FuzzyItemsCount == items_count && FuzzyMaxResults == max_results && FuzzyInputBuf.Size > 0 && strcmp(FuzzyInputBuf.Data, InputBuf) == 0);
+    if (!same_search)
+    {
+        FuzzyItems = items;
+        FuzzyItemsCount = items_count;
+        FuzzyItemsDone = 0;
+        FuzzyMaxResults = max_results;
+        FuzzyHeap.resize(0);
+        FuzzyHeap.reserve(ImMin(max_results, items_count));
+        FuzzyResults.resize(0);
+        const int input_len = (int)strlen(InputBuf);
+        FuzzyInputBuf.resize(input_len + 1);
+        memcpy(FuzzyInputBuf.Data, InputBuf, (size_t)input_len + 1);
+    }
+    if (FuzzyItemsDone == FuzzyItemsCount)
+        return true;
+
+    // Uppercase pattern without blanks
+    char pattern[IM_ARRAYSIZE(InputBuf)];
+    int pattern_len = 0;
+    for (const char* c = InputBuf; *c != 0; c++)
+        if (!ImCharIsBlankA(*c))
+            pattern[pattern_len++] = ImToUpperAscii(*c);
+
+    int items_end = (items_per_call > 0) ? ImMin(FuzzyItemsDone + items_per_call, FuzzyItemsCount) : FuzzyItemsCount;
+    ImGuiTextFuzzyResult result;
+    if (pattern_len == 0)
+    {
+        // Empty pattern: all items pass in their original order, so we can stop once we have enough
+        result.Score = 0;
+        for (result.Index = FuzzyItemsDone; result.Index < items_end && FuzzyHeap.Size < max_results; result.Index++)
+            FuzzyHeapPush(FuzzyHeap, max_results, result);
+        items_end = (FuzzyHeap.Size < max_results) ? items_end : FuzzyItemsCount;
+    }
+    else
+    {
+        for (result.Index = FuzzyItemsDone; result.Index < items_end; result.Index++)
+            if (items[result.Index] != NULL && FuzzyMatchScore(pattern, pattern_len, items[result.Index], &result.Score))
+                FuzzyHeapPush(FuzzyHeap, max_results, result);
+    }
+    FuzzyItemsDone = items_end;
+
+    // Output sorted results (partial while searching)
+    FuzzyResults.resize(FuzzyHeap.Size);
+    if (FuzzyHeap.Size > 0)
+    {
+        memcpy(FuzzyResults.Data, FuzzyHeap.Data, (size_t)FuzzyHeap.Size * sizeof(ImGuiTextFuzzyResult));
+        ImQsort(FuzzyResults.Data, (size_t)FuzzyResults.Size, sizeof(ImGuiTextFuzzyResult), FuzzyResultComparer);
+    }
+    return FuzzyItemsDone == FuzzyItemsCount;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImGuiTextBuffer
+//-----------------------------------------------------------------------------
+
+char ImGuiTextBuffer::EmptyString[1] = { 0 };
+
+void ImGuiTextBuffer::append(const char* str, const char* str_end)
+{
+    int len = str_end ? (int)(str_end - str) : (int)strlen(str);
+
+    // Add zero-terminator the first time
+    const int write_off = (Buf.Size != 0) ? Buf.Size : 1;
+    const int needed_sz = write_off + len;
+    if (write_off + len >= Buf.Capacity)
+    {
+        int new_capacity = Buf.Capacity * 2;
+        Buf.reserve(needed_sz > new_capacity ? needed_sz : new_capacity);
+    }
+
+    Buf.resize(needed_sz);
+    memcpy(&Buf[write_off - 1], str, (size_t)len);
+    Buf[write_off - 1 + len] = 0;
+}
+
+void ImGuiTextBuffer::appendf(const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    appendfv(fmt, args);
+    va_end(args);
+}
+
+// Helper: Text buffer for logging/accumulating text
+// We first try to format directly into the spare capacity, which mostly succeeds when appending repeatedly as capacity grows geometrically.
+// Only when the output was truncated we measure it, grow the buffer and format again.
+void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
+{
+    va_list args_copy;
+    va_copy(args_copy, args);
+
+    // Add zero-terminator the first time
+    const int write_off = (Buf.Size != 0) ? Buf.Size : 1;
+    const int write_avail = Buf.Capacity - (write_off - 1); // Including zero-terminator
+    int len;
+    if (write_avail > 1)
+    {
+        len = ImFormatStringV(Buf.Data + write_off - 1, (size_t)write_avail, fmt, args);
+        if (len < write_avail - 1) // Not truncated
+        {
+            if (len > 0)
+                Buf.resize(write_off + len);
+            va_end(args_copy);
+            return;
+        }
+        va_list args_measure;
+        va_copy(args_measure, args_copy);
+        len = ImFormatStringV(NULL, 0, fmt, args_measure);
+        va_end(args_measure);
+    }
+    else
+    {
+        len = ImFormatStringV(NULL, 0, fmt, args);
+    }
+    if (len <= 0)
+    {
+        va_end(args_copy);
+        return;
+    }
+
+    const int needed_sz = write_off + len;
+    if (write_off + len >= Buf.Capacity)
+    {
+        int new_capacity = Buf.Capacity * 2;
+        Buf.reserve(needed_sz > new_capacity ? needed_sz : new_capacity);
+    }
+
+    Buf.resize(needed_sz);
+    ImFormatStringV(&Buf[write_off - 1], (size_t)len + 1, fmt, args_copy);
+    va_end(args_copy);
+}
+
+//-----------------------------------------------------------------------------
 // [SECTION] ImGuiListClipper
 // This is currently not as flexible/powerful as it should be and really confusing/spaghetti, mostly because we changed
 // the API mid-way through development and support two ways to using the clipper, needs some rework (see TODO)
@@ -2671,6 +3595,7 @@ const char* ImGui::FindRenderedTextEnd(const char* text, const char* text_end)
 // RenderText***() functions calls ImDrawList::AddText() calls ImBitmapFont::RenderText()
 void ImGui::RenderText(ImVec2 pos, const char* text, const char* text_end, bool hide_text_after_hash)
 {
+    IMGUI_PROFILER_SCOPE("RenderText", NULL, 0);
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = g.CurrentWindow;
 
@@ -2697,6 +3622,7 @@ void ImGui::RenderText(ImVec2 pos, const char* text, const char* text_end, bool
 
 void ImGui::RenderTextWrapped(ImVec2 pos, const char* text, const char* text_end, float wrap_width)
 {
+    IMGUI_PROFILER_SCOPE("RenderText", NULL, 0);
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = g.CurrentWindow;
 
@@ -2715,6 +3641,7 @@ void ImGui::RenderTextWrapped(ImVec2 pos, const char* text, const char* text_end
 // Handle clipping on CPU immediately (vs typically let the GPU clip the triangles that are overlapping the clipping rectangle edges)
 void ImGui::RenderTextClippedEx(ImDrawList* draw_list, const ImVec2& pos_min, const ImVec2& pos_max, const char* text, const char* text_display_end, const ImVec2* text_size_if_known, const ImVec2& align, const ImRect* clip_rect)
 {
+    IMGUI_PROFILER_SCOPE("RenderText", NULL, 0);
     // Perform CPU side clipping for single clipped element to avoid using scissor state
     ImVec2 pos = pos_min;
     const ImVec2 text_size = text_size_if_known ? *text_size_if_known : CalcTextSize(text, text_display_end, false, 0.0f);
@@ -3046,10 +3973,86 @@ void ImGui::GcAwakeTransientWindowBuffers(ImGuiWindow* window)
 {
     // We stored capacity of the ImDrawList buffer to reduce growth-caused allocation/copy when awakening.
     // The other buffers tends to amortize much faster.
+    ImGuiContext& g = *GImGui;
     window->MemoryCompacted = false;
     window->DrawList->IdxBuffer.reserve(window->MemoryDrawListIdxCapacity);
     window->DrawList->VtxBuffer.reserve(window->MemoryDrawListVtxCapacity);
     window->MemoryDrawListIdxCapacity = window->MemoryDrawListVtxCapacity = 0;
+    window->MemoryDrawListIdxPeak = window->MemoryDrawListVtxPeak = 0; // Measure new high-water marks before trimming
+    window->MemoryDrawListTrimTime = (float)g.Time;
+}
+
+// Shrink draw list buffers of a visible window when they stayed well under their capacity since last time (e.g. after a one-off burst of contents).
+// Called by Begin() every io.ConfigMemoryCompactTimer seconds, while the buffers are empty.
+void ImGui::GcTrimTransientWindowBuffers(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    const int min_trim_size = 16 * 1024; // Don't bother for small buffers
+    ImDrawList* draw_list = window->DrawList;
+    IM_ASSERT(draw_list->IdxBuffer.Size == 0 && draw_list->VtxBuffer.Size == 0);
+    if (draw_list->IdxBuffer.Capacity > window->MemoryDrawListIdxPeak * 2 && (draw_list->IdxBuffer.Capacity - window->MemoryDrawListIdxPeak) * (int)sizeof(ImDrawIdx) >= min_trim_size)
+    {
+        draw_list->IdxBuffer.clear();
+        draw_list->IdxBuffer.reserve(window->MemoryDrawListIdxPeak);
+    }
+    if (draw_list->VtxBuffer.Capacity > window->MemoryDrawListVtxPeak * 2 && (draw_list->VtxBuffer.Capacity - window->MemoryDrawListVtxPeak) * (int)sizeof(ImDrawVert) >= min_trim_size)
+    {
+        draw_list->VtxBuffer.clear();
+        draw_list->VtxBuffer.reserve(window->MemoryDrawListVtxPeak);
+    }
+    window->MemoryDrawListIdxPeak = window->MemoryDrawListVtxPeak = 0;
+    window->MemoryDrawListTrimTime = (float)g.Time;
+}
+
+void ImGui::GcPrewarmWindow(const char* name)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = FindWindowByName(name);
+    if (window == NULL)
+        return;
+    if (window->MemoryCompacted)
+        GcAwakeTransientWindowBuffers(window);
+    window->LastTimeActive = (float)g.Time;
+}
+
+// Size of the buffers freed by GcCompactTransientWindowBuffers()
+static int GcCalcTransientWindowBuffersSize(ImGuiWindow* window)
+{
+    ImDrawList* draw_list = window->DrawList;
+    int size = draw_list->CmdBuffer.Capacity * (int)sizeof(ImDrawCmd) + draw_list->IdxBuffer.Capacity * (int)sizeof(ImDrawIdx) + draw_list->VtxBuffer.Capacity * (int)sizeof(ImDrawVert);
+    size += draw_list->ShapeBuffer.Capacity * (int)sizeof(ImDrawShape);
+    size += window->IDStack.Capacity * (int)sizeof(ImGuiID) + window->DC.ChildWindows.Capacity * (int)sizeof(ImGuiWindow*);
+    return size;
+}
+
+static int IMGUI_CDECL GcLastTimeActiveComparer(const void* lhs, const void* rhs)
+{
+    const float a = (*(const ImGuiWindow* const *)lhs)->LastTimeActive;
+    const float b = (*(const ImGuiWindow* const *)rhs)->LastTimeActive;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
+// Compact unused windows, least recently used first, until buffers kept by unused windows fit in io.ConfigMemoryCompactBudget.
+// Tables are compacted along with their outer window.
+static void GcCompactWindowsOverBudget(int unused_windows_size)
+{
+    ImGuiContext& g = *GImGui;
+    ImVector<ImGuiWindow*>& windows = g.WindowsTempSortBuffer;
+    windows.resize(0);
+    for (int i = 0; i != g.Windows.Size; i++)
+        if (!g.Windows[i]->WasActive && !g.Windows[i]->MemoryCompacted)
+            windows.push_back(g.Windows[i]);
+    ImQsort(windows.Data, (size_t)windows.Size, sizeof(ImGuiWindow*), GcLastTimeActiveComparer);
+    for (int i = 0; i < windows.Size && unused_windows_size > g.IO.ConfigMemoryCompactBudget; i++)
+    {
+        ImGuiWindow* window = windows[i];
+        unused_windows_size -= GcCalcTransientWindowBuffersSize(window);
+        ImGui::GcCompactTransientWindowBuffers(window);
+        for (int table_n = 0; table_n < g.TablesLastTimeActive.Size; table_n++)
+            if (g.TablesLastTimeActive[table_n] >= 0.0f && g.Tables.GetByIndex(table_n)->OuterWindow == window)
+                ImGui::TableGcCompactTransientBuffers(g.Tables.GetByIndex(table_n));
+    }
+    windows.resize(0);
 }
 
 void ImGui::SetActiveID(ImGuiID id, ImGuiWindow* window)
@@ -3327,12 +4330,43 @@ float ImGui::CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x)
     return ImMax(wrap_pos_x - pos.x, 1.0f);
 }
 
+#ifdef IMGUI_ENABLE_MEMORY_TAGS
+// Prefixed to each allocation so MemFree() can account it to the right tag.
+// 16 bytes to preserve the alignment guaranteed by the underlying allocator.
+struct ImGuiMemAllocHeader
+{
+    size_t      Size;
+    int         Tag;            // ImGuiMemTag, or -1 when allocated without a current context (not accounted)
+    char        _Padding[16 - sizeof(size_t) - sizeof(int)];
+};
+IM_STATIC_ASSERT(sizeof(ImGuiMemAllocHeader) == 16);
+#endif
+
 // IM_ALLOC() == ImGui::MemAlloc()
 void* ImGui::MemAlloc(size_t size)
 {
-    if (ImGuiContext* ctx = GImGui)
+    ImGuiContext* ctx = GImGui;
+    if (ctx)
         ctx->IO.MetricsActiveAllocations++;
+#ifdef IMGUI_ENABLE_MEMORY_TAGS
+    ImGuiMemAllocHeader* header = (ImGuiMemAllocHeader*)(*GImAllocatorAllocFunc)(size + sizeof(ImGuiMemAllocHeader), GImAllocatorUserData);
+    if (header == NULL)
+        return NULL;
+    header->Size = size;
+    header->Tag = ctx ? ctx->MemTag : -1;
+    if (ctx)
+    {
+        ImGuiMemTagStats* stats = &ctx->MemTagStats[ctx->MemTag];
+        stats->Bytes += (ImS64)size;
+        stats->BytesPeak = ImMax(stats->BytesPeak, stats->Bytes);
+        stats->Count++;
+        stats->CountPeak = ImMax(stats->CountPeak, stats->Count);
+        stats->CountTotal++;
+    }
+    return header + 1;
+#else
     return (*GImAllocatorAllocFunc)(size, GImAllocatorUserData);
+#endif
 }
 
 // IM_FREE() == ImGui::MemFree()
@@ -3341,9 +4375,51 @@ void ImGui::MemFree(void* ptr)
     if (ptr)
         if (ImGuiContext* ctx = GImGui)
             ctx->IO.MetricsActiveAllocations--;
+#ifdef IMGUI_ENABLE_MEMORY_TAGS
+    if (ptr)
+    {
+        ImGuiMemAllocHeader* header = (ImGuiMemAllocHeader*)ptr - 1;
+        ImGuiContext* ctx = GImGui;
+        if (ctx && header->Tag >= 0)
+        {
+            ImGuiMemTagStats* stats = &ctx->MemTagStats[header->Tag];
+            stats->Bytes -= (ImS64)header->Size;
+            stats->Count--;
+        }
+        ptr = header;
+    }
+#endif
     return (*GImAllocatorFreeFunc)(ptr, GImAllocatorUserData);
 }
 
+#ifdef IMGUI_ENABLE_MEMORY_TAGS
+// Like io.MetricsActiveAllocations, stats are updated on the current context: they may be off if you have multiple contexts
+const ImGuiMemTagStats* ImGui::GetMemTagStats(ImGuiMemTag tag)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(tag >= 0 && tag < ImGuiMemTag_COUNT);
+    return &g.MemTagStats[tag];
+}
+
+const char* ImGui::GetMemTagName(ImGuiMemTag tag)
+{
+    static const char* const names[] = { "Other", "Windows", "DrawLists", "Tables", "InputText", "Fonts", "Settings" };
+    IM_ASSERT(IM_ARRAYSIZE(names) == ImGuiMemTag_COUNT);
+    IM_ASSERT(tag >= 0 && tag < ImGuiMemTag_COUNT);
+    return names[tag];
+}
+
+void ImGui::ResetMemTagPeaks()
+{
+    ImGuiContext& g = *GImGui;
+    for (int tag = 0; tag < ImGuiMemTag_COUNT; tag++)
+    {
+        g.MemTagStats[tag].BytesPeak = g.MemTagStats[tag].Bytes;
+        g.MemTagStats[tag].CountPeak = g.MemTagStats[tag].Count;
+    }
+}
+#endif
+
 const char* ImGui::GetClipboardText()
 {
     ImGuiContext& g = *GImGui;
@@ -3638,6 +4714,104 @@ static bool IsWindowActiveAndVisible(ImGuiWindow* window)
     return (window->Active) && (!window->Hidden);
 }
 
+// Apply events queued by io.AddXXXEvent() functions to the io.MousePos/MouseDown[]/KeysDown[] etc. state, in submission order.
+// With input trickling, we stop at the first event which would hide an earlier change of this frame, and leave it and the
+// following events in the queue for the next frame. e.g. a button down+up within a same frame is seen as a click over two frames,
+// a mouse move following a click doesn't change the position the click happened at, a key press is seen by the characters typed after it.
+static void ImGui::UpdateInputEvents(bool trickle_fast_inputs)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiIO& io = g.IO;
+
+    // Only interleave keys and characters when text input is wanted, otherwise ordering between them doesn't matter
+    const bool trickle_interleaved_keys_and_text = trickle_fast_inputs && io.WantTextInput;
+
+    bool mouse_moved = false, mouse_wheeled = false, key_changed = false, key_mods_changed = false, text_inputted = false;
+    int mouse_button_changed = 0x00;
+    ImBitArray<IM_ARRAYSIZE(io.KeysDown)> key_changed_mask;
+
+    int event_n = 0;
+    for (; event_n < g.InputEventsQueue.Size; event_n++)
+    {
+        const ImGuiInputEvent* e = &g.InputEventsQueue[event_n];
+        if (e->Type == ImGuiInputEventType_MousePos)
+        {
+            ImVec2 event_pos(e->MousePos.PosX, e->MousePos.PosY);
+            if (io.MousePos.x == event_pos.x && io.MousePos.y == event_pos.y)
+                continue;
+            if (trickle_fast_inputs && (mouse_button_changed != 0 || mouse_wheeled || key_changed || key_mods_changed || text_inputted))
+                break;
+            io.MousePos = event_pos;
+            mouse_moved = true;
+        }
+        else if (e->Type == ImGuiInputEventType_MouseButton)
+        {
+            const int button = e->MouseButton.Button;
+            if (io.MouseDown[button] == e->MouseButton.Down)
+                continue;
+            if (trickle_fast_inputs && ((mouse_button_changed & (1 << button)) || mouse_wheeled))
+                break;
+            io.MouseDown[button] = e->MouseButton.Down;
+            mouse_button_changed |= (1 << button);
+        }
+        else if (e->Type == ImGuiInputEventType_MouseWheel)
+        {
+            if (trickle_fast_inputs && (mouse_moved || mouse_button_changed != 0))
+                break;
+            io.MouseWheelH += e->MouseWheel.WheelX;
+            io.MouseWheel += e->MouseWheel.WheelY;
+            mouse_wheeled = true;
+        }
+        else if (e->Type == ImGuiInputEventType_Key)
+        {
+            const int key = e->Key.Key;
+            if (io.KeysDown[key] == e->Key.Down)
+                continue;
+            if (trickle_fast_inputs && (key_changed_mask.TestBit(key) || mouse_button_changed != 0))
+                break;
+            if (trickle_interleaved_keys_and_text && text_inputted)
+                break;
+            io.KeysDown[key] = e->Key.Down;
+            key_changed_mask.SetBit(key);
+            key_changed = true;
+        }
+        else if (e->Type == ImGuiInputEventType_KeyMods)
+        {
+            const ImGuiKeyModFlags mods = e->KeyMods.Mods;
+            if (GetMergedKeyModFlags() == mods)
+                continue;
+            if (trickle_fast_inputs && (key_mods_changed || mouse_button_changed != 0))
+                break;
+            if (trickle_interleaved_keys_and_text && text_inputted)
+                break;
+            io.KeyCtrl = (mods & ImGuiKeyModFlags_Ctrl) != 0;
+            io.KeyShift = (mods & ImGuiKeyModFlags_Shift) != 0;
+            io.KeyAlt = (mods & ImGuiKeyModFlags_Alt) != 0;
+            io.KeySuper = (mods & ImGuiKeyModFlags_Super) != 0;
+            key_mods_changed = true;
+        }
+        else if (e->Type == ImGuiInputEventType_Char)
+        {
+            if (trickle_fast_inputs && (mouse_button_changed != 0 || mouse_moved || mouse_wheeled))
+                break;
+            if (trickle_interleaved_keys_and_text && (key_changed || key_mods_changed))
+                break;
+            io.InputQueueCharacters.push_back((ImWchar)e->Char.Char);
+            text_inputted = true;
+        }
+        else
+        {
+            IM_ASSERT(0 && "Unknown event!");
+        }
+    }
+
+    // Remove processed events
+    if (event_n == g.InputEventsQueue.Size)
+        g.InputEventsQueue.resize(0);
+    else
+        g.InputEventsQueue.erase(g.InputEventsQueue.Data, g.InputEventsQueue.Data + event_n);
+}
+
 static void ImGui::UpdateMouseInputs()
 {
     ImGuiContext& g = *GImGui;
@@ -3831,6 +5005,7 @@ void ImGui::UpdateTabFocus()
 // The reason this is exposed in imgui_internal.h is: on touch-based system that don't have hovering, we want to dispatch inputs to the right target (imgui vs imgui+app)
 void ImGui::UpdateHoveredWindowAndCaptureFlags()
 {
+    IMGUI_PROFILER_SCOPE("UpdateHoveredWindowAndCaptureFlags", NULL, 0);
     ImGuiContext& g = *GImGui;
     g.WindowsHoverPadding = ImMax(g.Style.TouchExtraPadding, ImVec2(WINDOWS_HOVER_PADDING, WINDOWS_HOVER_PADDING));
 
@@ -3938,7 +5113,9 @@ void ImGui::NewFrame()
     UpdateViewportsNewFrame();
 
     // Setup current font and draw list shared data
-    g.IO.Fonts->Locked = true;
+    // A shared font atlas is not locked: we don't write to it, as other contexts may be using it on other threads.
+    if (g.FontAtlasOwnedByContext)
+        g.IO.Fonts->Locked = true;
     SetCurrentFont(GetDefaultFont());
     IM_ASSERT(g.Font->IsLoaded());
     ImRect virtual_space(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
@@ -3956,6 +5133,8 @@ void ImGui::NewFrame()
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowVtxOffset;
+    if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasShapes)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowShapes;
 
     // Mark rendering data as invalid to prevent user who may have a handle on it to use it.
     for (int n = 0; n < g.Viewports.Size; n++)
@@ -4014,6 +5193,9 @@ void ImGui::NewFrame()
     g.DragDropWithinTarget = false;
     g.DragDropHoldJustPressedId = 0;
 
+    // Apply queued input events
+    UpdateInputEvents(g.IO.ConfigInputTrickleEventQueue);
+
     // Update keyboard input state
     // Synchronize io.KeyMods with individual modifiers io.KeyXXX bools
     g.IO.KeyMods = GetMergedKeyModFlags();
@@ -4052,7 +5234,8 @@ void ImGui::NewFrame()
 
     // Mark all windows as not visible and compact unused memory.
     IM_ASSERT(g.WindowsFocusOrder.Size <= g.Windows.Size);
-    const float memory_compact_start_time = (g.GcCompactAll || g.IO.ConfigMemoryCompactTimer < 0.0f) ? FLT_MAX : (float)g.Time - g.IO.ConfigMemoryCompactTimer;
+    const float memory_compact_start_time = g.GcCompactAll ? FLT_MAX : (g.IO.ConfigMemoryCompactTimer < 0.0f) ? -FLT_MAX : (float)g.Time - g.IO.ConfigMemoryCompactTimer;
+    int unused_windows_size = 0;
     for (int i = 0; i != g.Windows.Size; i++)
     {
         ImGuiWindow* window = g.Windows[i];
@@ -4064,7 +5247,11 @@ void ImGui::NewFrame()
         // Garbage collect transient buffers of recently unused windows
         if (!window->WasActive && !window->MemoryCompacted && window->LastTimeActive < memory_compact_start_time)
             GcCompactTransientWindowBuffers(window);
+        else if (!window->WasActive && !window->MemoryCompacted && g.IO.ConfigMemoryCompactBudget > 0)
+            unused_windows_size += GcCalcTransientWindowBuffersSize(window);
     }
+    if (g.IO.ConfigMemoryCompactBudget > 0 && unused_windows_size > g.IO.ConfigMemoryCompactBudget)
+        GcCompactWindowsOverBudget(unused_windows_size);
 
     // Garbage collect transient buffers of recently unused tables
     for (int i = 0; i < g.TablesLastTimeActive.Size; i++)
@@ -4073,6 +5260,43 @@ void ImGui::NewFrame()
     for (int i = 0; i < g.TablesTempDataStack.Size; i++)
         if (g.TablesTempDataStack[i].LastTimeActive >= 0.0f && g.TablesTempDataStack[i].LastTimeActive < memory_compact_start_time)
             TableGcCompactTransientBuffers(&g.TablesTempDataStack[i]);
+
+    // Garbage collect recorded output of recently unused cached regions
+    for (int i = 0; i < g.CachedRegions.GetBufSize(); i++)
+    {
+        ImGuiCachedRegion* region = g.CachedRegions.GetByIndex(i);
+        if (region->LastTimeActive >= 0.0f && region->LastTimeActive < memory_compact_start_time)
+        {
+            region->IsValid = false;
+            region->LastTimeActive = -1.0f;
+            region->VtxBuffer.clear();
+            region->IdxBuffer.clear();
+            region->CmdBuffer.clear();
+        }
+    }
+
+    // Garbage collect level-of-detail and stream columns of recently unused plots
+    for (int i = 0; i < g.PlotLods.GetBufSize(); i++)
+    {
+        ImGuiPlotLod* lod = g.PlotLods.GetByIndex(i);
+        if (lod->LastTimeActive >= 0.0f && lod->LastTimeActive < memory_compact_start_time)
+        {
+            lod->LastTimeActive = -1.0f;
+            lod->Nodes.clear();
+            lod->LevelOffsets.clear();
+        }
+    }
+    for (int i = 0; i < g.PlotStreams.GetBufSize(); i++)
+    {
+        ImGuiPlotStreamState* state = g.PlotStreams.GetByIndex(i);
+        if (state->LastTimeActive >= 0.0f && state->LastTimeActive < memory_compact_start_time)
+        {
+            state->LastTimeActive = -1.0f;
+            state->Stream = NULL;
+            state->Columns.clear();
+            state->VisibleColumns.clear();
+        }
+    }
     if (g.GcCompactAll)
         GcCompactTransientMiscBuffers();
     g.GcCompactAll = false;
@@ -4144,12 +5368,26 @@ void ImGui::Initialize(ImGuiContext* context)
         ini_handler.ReadLineFn = WindowSettingsHandler_ReadLine;
         ini_handler.ApplyAllFn = WindowSettingsHandler_ApplyAll;
         ini_handler.WriteAllFn = WindowSettingsHandler_WriteAll;
+    ini_handler.ReadBinaryFn = WindowSettingsHandler_ReadBinary;
+    ini_handler.WriteAllBinaryFn = WindowSettingsHandler_WriteAllBinary;
         g.SettingsHandlers.push_back(ini_handler);
     }
 
     // Add .ini handle for ImGuiTable type
     TableSettingsInstallHandler(context);
 
+#ifdef IMGUI_ENABLE_PROFILER
+    // Frame profiler delimits frames using context hooks
+    g.Profiler.ClockFrequency = ProfilerGetClockFrequency();
+    for (int hook_type = ImGuiContextHookType_NewFramePre; hook_type <= ImGuiContextHookType_RenderPost; hook_type++)
+    {
+        ImGuiContextHook hook;
+        hook.Type = (ImGuiContextHookType)hook_type;
+        hook.Callback = ProfilerContextHook;
+        AddContextHook(context, &hook);
+    }
+#endif
+
     // Create default viewport
     ImGuiViewportP* viewport = IM_NEW(ImGuiViewportP)();
     g.Viewports.push_back(viewport);
@@ -4177,18 +5415,28 @@ void ImGui::Shutdown(ImGuiContext* context)
         return;
 
     // Save settings (unless we haven't attempted to load them: CreateContext/DestroyContext without a call to NewFrame shouldn't save an empty file)
-    if (g.SettingsLoaded && g.IO.IniFilename != NULL)
+    // Wait for a pending asynchronous write first, as its data is owned by the context.
     {
         ImGuiContext* backup_context = GImGui;
         SetCurrentContext(&g);
-        SaveIniSettingsToDisk(g.IO.IniFilename);
+        IniWaitPendingWrite();
+        if (g.SettingsLoaded && g.IO.IniFilename != NULL)
+            SaveIniSettingsToDisk(g.IO.IniFilename);
         SetCurrentContext(backup_context);
     }
 
     CallContextHooks(&g, ImGuiContextHookType_Shutdown);
+#ifdef IMGUI_ENABLE_PROFILER
+    ProfilerTraceFinishEx(&g);
+#endif
 
     // Clear everything else
     g.Windows.clear_delete();
+    g.WindowsHoverGrid.Windows.clear();
+    g.WindowsHoverGrid.Rects.clear();
+    g.WindowsHoverGrid.CellStart.clear();
+    g.WindowsHoverGrid.CellWindows.clear();
+    g.WindowsHoverGrid.Valid = false;
     g.WindowsFocusOrder.clear();
     g.WindowsTempSortBuffer.clear();
     g.CurrentWindow = NULL;
@@ -4213,14 +5461,20 @@ void ImGui::Shutdown(ImGuiContext* context)
     g.Tables.Clear();
     g.TablesTempDataStack.clear_destruct();
     g.DrawChannelsTempMergeBuffer.clear();
+    g.CachedRegions.Clear();
+    g.CachedRegionsStack.clear();
+    g.PlotLods.Clear();
+    g.PlotStreams.Clear();
 
     g.ClipboardHandlerData.clear();
     g.MenusIdSubmittedThisFrame.clear();
     g.InputTextState.ClearFreeMemory();
+    g.InputEventsQueue.clear();
 
     g.SettingsWindows.clear();
     g.SettingsHandlers.clear();
 
+    LogFlush(g); // Pending output to tty/file/callback (see LOG_FLUSH_SIZE)
     if (g.LogFile)
     {
 #ifndef IMGUI_DISABLE_TTY_FUNCTIONS
@@ -4349,6 +5603,7 @@ static void SetupViewportDrawData(ImGuiViewportP* viewport, ImVector<ImDrawList*
     draw_data->DisplayPos = viewport->Pos;
     draw_data->DisplaySize = viewport->Size;
     draw_data->FramebufferScale = io.DisplayFramebufferScale;
+    draw_data->BuffersMerged = false;
     for (int n = 0; n < draw_lists->Size; n++)
     {
         draw_data->TotalVtxCount += draw_lists->Data[n]->VtxBuffer.Size;
@@ -4447,9 +5702,15 @@ void ImGui::EndFrame()
     IM_ASSERT(g.Windows.Size == g.WindowsTempSortBuffer.Size);
     g.Windows.swap(g.WindowsTempSortBuffer);
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
+    UpdateWindowHoverGrid();
+
+    // Write pending tty/file/callback log output, so it doesn't lag behind by up to LOG_FLUSH_SIZE bytes
+    if (g.LogEnabled)
+        LogFlush(g);
 
     // Unlock font atlas
-    g.IO.Fonts->Locked = false;
+    if (g.FontAtlasOwnedByContext)
+        g.IO.Fonts->Locked = false;
 
     // Clear Input data for next frame
     g.IO.MouseWheel = g.IO.MouseWheelH = 0.0f;
@@ -4462,6 +5723,7 @@ void ImGui::EndFrame()
 void ImGui::Render()
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
     IM_ASSERT(g.Initialized);
 
     if (g.FrameCountEnded != g.FrameCount)
@@ -4517,6 +5779,24 @@ void ImGui::Render()
     }
 
     CallContextHooks(&g, ImGuiContextHookType_RenderPost);
+
+    // Optionally write all vertices/indices straight into renderer provided buffers
+    if (g.IO.RenderGetMergedBuffersFn != NULL)
+    {
+        IM_ASSERT((g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset) && "Merged draw data output requires a renderer honoring ImDrawCmd::VtxOffset!");
+        for (int n = 0; n < g.Viewports.Size; n++)
+        {
+            ImDrawData* draw_data = &g.Viewports[n]->DrawDataP;
+            void* vtx_dst = NULL;
+            void* idx_dst = NULL;
+            if (draw_data->CmdListsCount > 0 && g.IO.RenderGetMergedBuffersFn(g.IO.RenderGetMergedBuffersUserData, draw_data, &vtx_dst, &idx_dst))
+            {
+                draw_data->MergeBuffers((ImDrawVert*)vtx_dst, (ImDrawIdx*)idx_dst);
+                if (g.IO.RenderMergeDrawCmds)
+                    draw_data->MergeDrawCmds((ImDrawIdx*)idx_dst);
+            }
+        }
+    }
 }
 
 // Calculate text size. Text can be multi-line. Optionally ignore text after a ## marker.
@@ -4551,6 +5831,31 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
 // FIXME: Note that we have an inconsequential lag here: OuterRectClipped is updated in Begin(), so windows moved programmatically
 // with SetWindowPos() and not SetNextWindowPos() will have that rectangle lagging by a frame at the time FindHoveredWindow() is
 // called, aka before the next Begin(). Moving window isn't affected.
+// Test one window for FindHoveredWindow(). Return true once both hovered windows have been found.
+static bool FindHoveredWindowTestWindow(ImGuiWindow* window, const ImRect& bb, ImGuiWindow** hovered_window, ImGuiWindow** hovered_window_ignoring_moving_window)
+{
+    ImGuiContext& g = *GImGui;
+    if (!bb.Contains(g.IO.MousePos))
+        return false;
+
+    // Support for one rectangular hole in any given window
+    // FIXME: Consider generalizing hit-testing override (with more generic data, callback, etc.) (#1512)
+    if (window->HitTestHoleSize.x != 0)
+    {
+        ImVec2 hole_pos(window->Pos.x + (float)window->HitTestHoleOffset.x, window->Pos.y + (float)window->HitTestHoleOffset.y);
+        ImVec2 hole_size((float)window->HitTestHoleSize.x, (float)window->HitTestHoleSize.y);
+        if (ImRect(hole_pos, hole_pos + hole_size).Contains(g.IO.MousePos))
+            return false;
+    }
+
+    if (*hovered_window == NULL)
+        *hovered_window = window;
+    IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
+    if (*hovered_window_ignoring_moving_window == NULL && (!g.MovingWindow || window->RootWindow != g.MovingWindow->RootWindow))
+        *hovered_window_ignoring_moving_window = window;
+    return *hovered_window && *hovered_window_ignoring_moving_window;
+}
+
 static void FindHoveredWindow()
 {
     ImGuiContext& g = *GImGui;
@@ -4562,47 +5867,117 @@ static void FindHoveredWindow()
 
     ImVec2 padding_regular = g.Style.TouchExtraPadding;
     ImVec2 padding_for_resize = g.IO.ConfigWindowsResizeFromEdges ? g.WindowsHoverPadding : padding_regular;
-    for (int i = g.Windows.Size - 1; i >= 0; i--)
+    ImGuiWindowHoverGrid& grid = g.WindowsHoverGrid;
+    if (grid.Valid && grid.PaddingRegular.x == padding_regular.x && grid.PaddingRegular.y == padding_regular.y && grid.PaddingForResize.x == padding_for_resize.x && grid.PaddingForResize.y == padding_for_resize.y)
     {
-        ImGuiWindow* window = g.Windows[i];
-        IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
-        if (!window->Active || window->Hidden)
-            continue;
-        if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
-            continue;
-
-        // Using the clipped AABB, a child window will typically be clipped by its parent (not always)
-        ImRect bb(window->OuterRectClipped);
-        if (window->Flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize))
-            bb.Expand(padding_regular);
-        else
-            bb.Expand(padding_for_resize);
-        if (!bb.Contains(g.IO.MousePos))
-            continue;
-
-        // Support for one rectangular hole in any given window
-        // FIXME: Consider generalizing hit-testing override (with more generic data, callback, etc.) (#1512)
-        if (window->HitTestHoleSize.x != 0)
+        // Only test windows overlapping the grid cell under the mouse, in the same back to front order
+        if (grid.Bounds.Contains(g.IO.MousePos))
         {
-            ImVec2 hole_pos(window->Pos.x + (float)window->HitTestHoleOffset.x, window->Pos.y + (float)window->HitTestHoleOffset.y);
-            ImVec2 hole_size((float)window->HitTestHoleSize.x, (float)window->HitTestHoleSize.y);
-            if (ImRect(hole_pos, hole_pos + hole_size).Contains(g.IO.MousePos))
-                continue;
+            const int cell_n = grid.GetCellY(g.IO.MousePos.y) * grid.CellsX + grid.GetCellX(g.IO.MousePos.x);
+            for (int n = grid.CellStart[cell_n + 1] - 1; n >= grid.CellStart[cell_n]; n--)
+            {
+                const int window_n = grid.CellWindows[n];
+                if (FindHoveredWindowTestWindow(grid.Windows[window_n], grid.Rects[window_n], &hovered_window, &hovered_window_ignoring_moving_window))
+                    break;
+            }
         }
+    }
+    else
+    {
+        for (int i = g.Windows.Size - 1; i >= 0; i--)
+        {
+            ImGuiWindow* window = g.Windows[i];
+            IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
+            if (!window->Active || window->Hidden)
+                continue;
+            if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
+                continue;
 
-        if (hovered_window == NULL)
-            hovered_window = window;
-        IM_MSVC_WARNING_SUPPRESS(28182); // [Static Analyzer] Dereferencing NULL pointer.
-        if (hovered_window_ignoring_moving_window == NULL && (!g.MovingWindow || window->RootWindow != g.MovingWindow->RootWindow))
-            hovered_window_ignoring_moving_window = window;
-        if (hovered_window && hovered_window_ignoring_moving_window)
-            break;
+            // Using the clipped AABB, a child window will typically be clipped by its parent (not always)
+            ImRect bb(window->OuterRectClipped);
+            if (window->Flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize))
+                bb.Expand(padding_regular);
+            else
+                bb.Expand(padding_for_resize);
+            if (FindHoveredWindowTestWindow(window, bb, &hovered_window, &hovered_window_ignoring_moving_window))
+                break;
+        }
     }
 
     g.HoveredWindow = hovered_window;
     g.HoveredWindowUnderMovingWindow = hovered_window_ignoring_moving_window;
 }
 
+// Called by EndFrame() once windows are sorted in display order: gather hit-test rectangles used by next frame's FindHoveredWindow().
+// With many windows, bucket them into a uniform grid so the query only tests windows overlapping the mouse position.
+static void UpdateWindowHoverGrid()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindowHoverGrid& grid = g.WindowsHoverGrid;
+    grid.Valid = false;
+    grid.Windows.resize(0);
+    grid.Rects.resize(0);
+    grid.PaddingRegular = g.Style.TouchExtraPadding;
+    grid.PaddingForResize = g.IO.ConfigWindowsResizeFromEdges ? g.WindowsHoverPadding : grid.PaddingRegular;
+    if (g.WindowsActiveCount < WINDOWS_HOVER_GRID_MIN_COUNT)
+        return;
+
+    // Same filtering and rectangles as the linear path of FindHoveredWindow()
+    grid.Bounds = ImRect(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (int i = 0; i < g.Windows.Size; i++)
+    {
+        ImGuiWindow* window = g.Windows[i];
+        if (!window->Active || window->Hidden || (window->Flags & ImGuiWindowFlags_NoMouseInputs))
+            continue;
+        ImRect bb(window->OuterRectClipped);
+        bb.Expand((window->Flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize)) ? grid.PaddingRegular : grid.PaddingForResize);
+        grid.Windows.push_back(window);
+        grid.Rects.push_back(bb);
+        grid.Bounds.Add(bb);
+    }
+    if (grid.Windows.Size < WINDOWS_HOVER_GRID_MIN_COUNT || grid.Bounds.IsInverted())
+        return;
+
+    // Aim for a few windows per cell
+    const int cells_per_axis = ImClamp((int)ImSqrt((float)grid.Windows.Size * 0.25f), 1, 16);
+    const ImVec2 bounds_size = grid.Bounds.GetSize();
+    grid.CellsX = grid.CellsY = cells_per_axis;
+    grid.CellScale = ImVec2(bounds_size.x > 0.0f ? cells_per_axis / bounds_size.x : 0.0f, bounds_size.y > 0.0f ? cells_per_axis / bounds_size.y : 0.0f);
+
+    // Count windows per cell. Give up if windows are so large that the grid wouldn't save us much work.
+    const int cells_count = grid.CellsX * grid.CellsY;
+    grid.CellStart.resize(cells_count + 1);
+    memset(grid.CellStart.Data, 0, (size_t)grid.CellStart.size_in_bytes());
+    int total_count = 0;
+    for (int window_n = 0; window_n < grid.Windows.Size; window_n++)
+    {
+        const ImRect& bb = grid.Rects[window_n];
+        const int x0 = grid.GetCellX(bb.Min.x), x1 = grid.GetCellX(bb.Max.x);
+        const int y0 = grid.GetCellY(bb.Min.y), y1 = grid.GetCellY(bb.Max.y);
+        for (int y = y0; y <= y1; y++)
+            for (int x = x0; x <= x1; x++)
+                grid.CellStart[y * grid.CellsX + x]++;
+        total_count += (x1 - x0 + 1) * (y1 - y0 + 1);
+    }
+    if (total_count > grid.Windows.Size * 4)
+        return;
+
+    // Convert counts to end offsets, then fill cells walking windows front to back so each cell ends up sorted back to front
+    for (int cell_n = 1; cell_n <= cells_count; cell_n++)
+        grid.CellStart[cell_n] += grid.CellStart[cell_n - 1];
+    grid.CellWindows.resize(total_count);
+    for (int window_n = grid.Windows.Size - 1; window_n >= 0; window_n--)
+    {
+        const ImRect& bb = grid.Rects[window_n];
+        const int x0 = grid.GetCellX(bb.Min.x), x1 = grid.GetCellX(bb.Max.x);
+        const int y0 = grid.GetCellY(bb.Min.y), y1 = grid.GetCellY(bb.Max.y);
+        for (int y = y0; y <= y1; y++)
+            for (int x = x0; x <= x1; x++)
+                grid.CellWindows[--grid.CellStart[y * grid.CellsX + x]] = window_n;
+    }
+    grid.Valid = true;
+}
+
 // Test if mouse cursor is hovering given rectangle
 // NB- Rectangle is clipped by our current clip setting
 // NB- Expand the rectangle to be generous on imprecise inputs systems (g.Style.TouchExtraPadding)
@@ -5124,6 +6499,7 @@ static void ApplyWindowSettings(ImGuiWindow* window, ImGuiWindowSettings* settin
 static ImGuiWindow* CreateNewWindow(const char* name, ImGuiWindowFlags flags)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_Windows);
     //IMGUI_DEBUG_LOG("CreateNewWindow '%s', flags = 0x%08X\n", name, flags);
 
     // Create window the first time
@@ -5170,6 +6546,7 @@ static ImGuiWindow* CreateNewWindow(const char* name, ImGuiWindowFlags flags)
         g.Windows.push_front(window); // Quite slow but rare and only once
     else
         g.Windows.push_back(window);
+    g.WindowsHoverGrid.Valid = false;
     return window;
 }
 
@@ -5726,6 +7103,7 @@ void ImGui::UpdateWindowParentAndRootLinks(ImGuiWindow* window, ImGuiWindowFlags
 bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_Windows);
     const ImGuiStyle& style = g.Style;
     IM_ASSERT(name != NULL && name[0] != '\0');     // Window name required
     IM_ASSERT(g.WithinFrameScope);                  // Forgot to call ImGui::NewFrame()
@@ -5748,6 +7126,11 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     const bool first_begin_of_the_frame = (window->LastFrameActive != current_frame);
     window->IsFallbackWindow = (g.CurrentWindowStack.Size == 0 && g.WithinFrameScopeWithImplicitWindow);
 
+    // Profiler: time spent in the window (closed by End()) and in this function
+    if (!window->IsFallbackWindow)
+        IMGUI_PROFILER_BEGIN("Window", window->Name, window->ID);
+    IMGUI_PROFILER_SCOPE("Begin", NULL, 0);
+
     // Update the Appearing flag
     bool window_just_activated_by_user = (window->LastFrameActive < current_frame - 1);   // Not using !WasActive because the implicit "Debug" window would always toggle off->on
     if (flags & ImGuiWindowFlags_Popup)
@@ -5861,12 +7244,17 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->HasCloseButton = (p_open != NULL);
         window->ClipRect = ImVec4(-FLT_MAX, -FLT_MAX, +FLT_MAX, +FLT_MAX);
         window->IDStack.resize(1);
+        window->MemoryDrawListIdxPeak = ImMax(window->MemoryDrawListIdxPeak, window->DrawList->IdxBuffer.Size); // Contents of last frame
+        window->MemoryDrawListVtxPeak = ImMax(window->MemoryDrawListVtxPeak, window->DrawList->VtxBuffer.Size);
         window->DrawList->_ResetForNewFrame();
         window->DC.CurrentTableIdx = -1;
 
-        // Restore buffer capacity when woken from a compacted state, to avoid
+        // Restore buffer capacity when woken from a compacted state, to avoid iterative growth.
+        // Otherwise periodically trim buffers which got much larger than recently needed.
         if (window->MemoryCompacted)
             GcAwakeTransientWindowBuffers(window);
+        else if (g.IO.ConfigMemoryCompactTimer >= 0.0f && (float)g.Time - window->MemoryDrawListTrimTime >= g.IO.ConfigMemoryCompactTimer)
+            GcTrimTransientWindowBuffers(window);
 
         // Update stored window name when it changes (which can _only_ happen with the "###" operator, so the ID would stay unchanged).
         // The title bar always display the 'name' parameter, so we only update the string storage if it needs to be visible to the end-user elsewhere.
@@ -5953,6 +7341,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 
         // Calculate auto-fit size, handle automatic resize
         const ImVec2 size_auto_fit = CalcWindowAutoFitSize(window, window->ContentSizeIdeal);
+        const ImVec2 size_full_prev = window->SizeFull;
         bool use_current_size_for_scrollbar_x = window_just_created;
         bool use_current_size_for_scrollbar_y = window_just_created;
         if ((flags & ImGuiWindowFlags_AlwaysAutoResize) && !window->Collapsed)
@@ -5989,6 +7378,8 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 
         // Apply minimum/maximum window size constraints and final size
         window->SizeFull = CalcWindowSizeAfterConstraint(window, window->SizeFull);
+        if ((flags & ImGuiWindowFlags_AlwaysAutoResize) && (window->SizeFull.x != size_full_prev.x || window->SizeFull.y != size_full_prev.y))
+            MarkIniSettingsDirty(window);
         window->Size = window->Collapsed && !(flags & ImGuiWindowFlags_ChildWindow) ? window->TitleBarRect().GetSize() : window->SizeFull;
 
         // Decoration size
@@ -6370,6 +7761,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 void ImGui::End()
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_Windows);
     ImGuiWindow* window = g.CurrentWindow;
 
     // Error checking: verify that user hasn't called End() too many times!
@@ -6383,6 +7775,7 @@ void ImGui::End()
     // Error checking: verify that user doesn't directly call End() on a child window.
     if (window->Flags & ImGuiWindowFlags_ChildWindow)
         IM_ASSERT_USER_ERROR(g.WithinEndChild, "Must call EndChild() and not End()!");
+    IMGUI_PROFILER_BEGIN("End", NULL, 0);
 
     // Close anything that is open
     if (window->DC.CurrentColumns)
@@ -6399,6 +7792,10 @@ void ImGui::End()
         g.BeginPopupStack.pop_back();
     window->DC.StackSizesOnBegin.CompareWithCurrentState();
     SetCurrentWindow(g.CurrentWindowStack.empty() ? NULL : g.CurrentWindowStack.back());
+
+    IMGUI_PROFILER_END(); // "End"
+    if (!window->IsFallbackWindow)
+        IMGUI_PROFILER_END(); // "Window", opened by Begin()
 }
 
 void ImGui::BringWindowToFocusFront(ImGuiWindow* window)
@@ -6428,6 +7825,7 @@ void ImGui::BringWindowToDisplayFront(ImGuiWindow* window)
     ImGuiWindow* current_front_window = g.Windows.back();
     if (current_front_window == window || current_front_window->RootWindow == window) // Cheap early out (could be better)
         return;
+    g.WindowsHoverGrid.Valid = false;
     for (int i = g.Windows.Size - 2; i >= 0; i--) // We can ignore the top-most window
         if (g.Windows[i] == window)
         {
@@ -6442,6 +7840,7 @@ void ImGui::BringWindowToDisplayBack(ImGuiWindow* window)
     ImGuiContext& g = *GImGui;
     if (g.Windows[0] == window)
         return;
+    g.WindowsHoverGrid.Valid = false;
     for (int i = 0; i < g.Windows.Size; i++)
         if (g.Windows[i] == window)
         {
@@ -6761,6 +8160,8 @@ void ImGui::SetWindowPos(ImGuiWindow* window, const ImVec2& pos, ImGuiCond cond)
     window->DC.CursorMaxPos += offset;      // And more importantly we need to offset CursorMaxPos/CursorStartPos this so ContentSize calculation doesn't get affected.
     window->DC.IdealMaxPos += offset;
     window->DC.CursorStartPos += offset;
+    if (offset.x != 0.0f || offset.y != 0.0f)
+        MarkIniSettingsDirty(window);
 }
 
 void ImGui::SetWindowPos(const ImVec2& pos, ImGuiCond cond)
@@ -6791,6 +8192,7 @@ void ImGui::SetWindowSize(ImGuiWindow* window, const ImVec2& size, ImGuiCond con
     window->SetWindowSizeAllowFlags &= ~(ImGuiCond_Once | ImGuiCond_FirstUseEver | ImGuiCond_Appearing);
 
     // Set
+    const ImVec2 old_size = window->SizeFull;
     if (size.x > 0.0f)
     {
         window->AutoFitFramesX = 0;
@@ -6811,6 +8213,8 @@ void ImGui::SetWindowSize(ImGuiWindow* window, const ImVec2& size, ImGuiCond con
         window->AutoFitFramesY = 2;
         window->AutoFitOnlyGrows = false;
     }
+    if (window->SizeFull.x != old_size.x || window->SizeFull.y != old_size.y)
+        MarkIniSettingsDirty(window);
 }
 
 void ImGui::SetWindowSize(const ImVec2& size, ImGuiCond cond)
@@ -6832,6 +8236,8 @@ void ImGui::SetWindowCollapsed(ImGuiWindow* window, bool collapsed, ImGuiCond co
     window->SetWindowCollapsedAllowFlags &= ~(ImGuiCond_Once | ImGuiCond_FirstUseEver | ImGuiCond_Appearing);
 
     // Set
+    if (window->Collapsed != collapsed)
+        MarkIniSettingsDirty(window);
     window->Collapsed = collapsed;
 }
 
@@ -7187,6 +8593,10 @@ static void ImGui::ErrorCheckNewFrameSanityChecks()
     if (g.IO.ConfigFlags & ImGuiConfigFlags_NavEnableKeyboard)
         IM_ASSERT(g.IO.KeyMap[ImGuiKey_Space] != -1 && "ImGuiKey_Space is not mapped, required for keyboard navigation.");
 
+    // Check: asynchronous .ini writes need a way to wait for completion (see io.IniWriteAsyncFn)
+    if (g.IO.IniWriteAsyncFn != NULL)
+        IM_ASSERT(g.IO.IniWriteAsyncWaitFn != NULL && "io.IniWriteAsyncFn requires io.IniWriteAsyncWaitFn to be set.");
+
     // Check: the io.ConfigWindowsResizeFromEdges option requires backend to honor mouse cursor changes and set the ImGuiBackendFlags_HasMouseCursors flag accordingly.
     if (g.IO.ConfigWindowsResizeFromEdges && !(g.IO.BackendFlags & ImGuiBackendFlags_HasMouseCursors))
         g.IO.ConfigWindowsResizeFromEdges = false;
@@ -7824,6 +9234,256 @@ void ImGui::EndGroup()
     //window->DrawList->AddRect(group_bb.Min, group_bb.Max, IM_COL32(255,0,255,255));   // [Debug]
 }
 
+// Cached regions: record the draw output of a part of a window, and replay it on following frames instead of submitting its contents.
+// - The recorded output is replayed while 'version' is unchanged, the region starts at the same position with the same clipping rectangle,
+//   style, font and item flags, and the user is not interacting with it (mouse hovering, active item, navigation request, logging..).
+//   Otherwise the contents are submitted normally and recorded again.
+// - You need to change 'version' whenever the contents would render differently: different data, labels, open state of tree nodes, etc.
+// - Contents are not allowed to create windows (child windows, popups, tooltips), tables or columns, nor to move to another table cell
+//   or column: such recordings are discarded. A region may however be submitted inside a table cell or a column.
+// - The region is a group, so you can use IsItemHovered() and layout functions such as SameLine() after EndCachedRegion().
+// - Usage:
+//     if (ImGui::BeginCachedRegion("properties", my_data_version))
+//     {
+//         [...] submit contents
+//     }
+//     ImGui::EndCachedRegion();
+static bool CachedRegionIsInteractedWith(ImGuiWindow* window, const ImRect& bb)
+{
+    ImGuiContext& g = *GImGui;
+    if (window->SkipItems || g.LogEnabled || g.DragDropActive || g.DebugItemPickerActive)
+        return true;
+    if ((g.ActiveId != 0 && g.ActiveIdWindow == window) || (g.ActiveIdPreviousFrame != 0 && g.ActiveIdPreviousFrameWindow == window))
+        return true;
+    if (g.NavAnyRequest && g.NavWindow && g.NavWindow->RootWindowForNav == window->RootWindowForNav)
+        return true;
+    if (g.TabFocusRequestCurrWindow == window)
+        return true;
+
+    // Items may be hovered outside of the group bounding box (e.g. Selectable() extends to the window edges and into item spacing)
+    if (g.HoveredWindow == window)
+    {
+        ImRect hover_bb(window->Pos.x, bb.Min.y - g.Style.ItemSpacing.y, window->Pos.x + window->Size.x, bb.Max.y + g.Style.ItemSpacing.y);
+        if (hover_bb.Contains(g.IO.MousePos))
+            return true;
+    }
+    return false;
+}
+
+bool ImGui::BeginCachedRegion(const char* str_id, ImU32 version)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    ImDrawList* draw_list = window->DrawList;
+
+    const ImGuiID id = window->GetID(str_id);
+    ImGuiCachedRegion* region = g.CachedRegions.GetOrAddByKey(id);
+    IM_ASSERT(region->LastFrameActive != g.FrameCount && "Called BeginCachedRegion() twice with the same ID in the same frame!");
+    region->ID = id;
+    region->LastFrameActive = g.FrameCount;
+    region->LastTimeActive = (float)g.Time;
+    g.CachedRegionsStack.push_back(g.CachedRegions.GetIndex(region));
+
+    BeginGroup();
+
+    const ImVec2 start_pos = window->DC.CursorPos;
+    const ImU32 style_hash = ImHashData(&g.Style, sizeof(g.Style));
+    bool replay = region->IsValid && region->Version == version && region->WindowID == window->ID && region->StyleHash == style_hash;
+    replay = replay && region->Font == g.Font && region->FontSize == g.FontSize && region->ItemFlags == g.CurrentItemFlags && region->DrawListFlags == draw_list->Flags;
+    replay = replay && region->ItemWidth == window->DC.ItemWidth && region->TextWrapPos == window->DC.TextWrapPos;
+    replay = replay && region->StartPos.x == start_pos.x && region->StartPos.y == start_pos.y && memcmp(&region->ClipRect, &window->ClipRect, sizeof(ImRect)) == 0;
+    replay = replay && memcmp(&region->DrawListClipRect, &draw_list->_CmdHeader.ClipRect, sizeof(ImVec4)) == 0 && region->DrawListTextureId == draw_list->_CmdHeader.TextureId;
+    replay = replay && !(region->NavId != 0 && region->NavId == g.NavId && !g.NavDisableHighlight);
+    replay = replay && !CachedRegionIsInteractedWith(window, ImRect(start_pos, start_pos + region->Size));
+
+    if (!replay)
+    {
+        // Submit and record contents
+        region->IsValid = region->IsReplaying = false;
+        region->Version = version;
+        region->WindowID = window->ID;
+        region->StyleHash = style_hash;
+        region->Font = g.Font;
+        region->FontSize = g.FontSize;
+        region->ItemFlags = g.CurrentItemFlags;
+        region->DrawListFlags = draw_list->Flags;
+        region->ItemWidth = window->DC.ItemWidth;
+        region->TextWrapPos = window->DC.TextWrapPos;
+        region->StartPos = start_pos;
+        region->ClipRect = window->ClipRect;
+        region->DrawListClipRect = draw_list->_CmdHeader.ClipRect;
+        region->DrawListTextureId = draw_list->_CmdHeader.TextureId;
+        region->BackupVtxBufferSize = draw_list->VtxBuffer.Size;
+        region->BackupIdxBufferSize = draw_list->IdxBuffer.Size;
+        region->BackupVtxOffset = draw_list->_CmdHeader.VtxOffset;
+        region->BackupChannel = draw_list->_Splitter._Current;
+        region->BackupWindowsActiveCount = g.WindowsActiveCount;
+        region->BackupTablesBeginCount = g.TablesBeginCount;
+        region->BackupColumnsBeginCount = g.ColumnsBeginCount;
+        region->BackupCurrentTable = g.CurrentTable;
+        region->BackupTableCurrentRow = g.CurrentTable ? g.CurrentTable->CurrentRow : 0;
+        region->BackupTableCurrentColumn = g.CurrentTable ? g.CurrentTable->CurrentColumn : 0;
+        region->BackupCurrentColumns = window->DC.CurrentColumns;
+        region->BackupColumnsCurrent = window->DC.CurrentColumns ? window->DC.CurrentColumns->Current : 0;
+        region->BackupFocusCounterRegular = window->DC.FocusCounterRegular;
+        region->BackupFocusCounterTabStop = window->DC.FocusCounterTabStop;
+        region->BackupNavLayersActiveMask = window->DC.NavLayersActiveMaskNext;
+        region->BackupNavIdIsAlive = g.NavIdIsAlive;
+        region->BackupIdealMaxPos = window->DC.IdealMaxPos;
+        window->DC.NavLayersActiveMaskNext = 0;
+        window->DC.IdealMaxPos = start_pos;
+        return true;
+    }
+
+    // Replay recorded output, re-creating draw commands through the regular ImDrawList code paths so they get merged as usual
+    region->IsReplaying = true;
+    unsigned int vtx_base = 0;
+    const ImDrawIdx* src_idx = region->IdxBuffer.Data;
+    for (int cmd_n = 0; cmd_n < region->CmdBuffer.Size; cmd_n++)
+    {
+        const ImGuiCachedRegionCmd& cmd = region->CmdBuffer[cmd_n];
+        draw_list->_CmdHeader.ClipRect = cmd.ClipRect;
+        draw_list->_OnChangedClipRect();
+        draw_list->_CmdHeader.TextureId = cmd.TextureId;
+        draw_list->_OnChangedTextureID();
+        draw_list->PrimReserve((int)cmd.ElemCount, (cmd_n == 0) ? region->VtxBuffer.Size : 0);
+        if (cmd_n == 0)
+        {
+            memcpy(draw_list->_VtxWritePtr, region->VtxBuffer.Data, (size_t)region->VtxBuffer.size_in_bytes());
+            vtx_base = draw_list->_VtxCurrentIdx;
+            draw_list->_VtxWritePtr += region->VtxBuffer.Size;
+            draw_list->_VtxCurrentIdx += (unsigned int)region->VtxBuffer.Size;
+        }
+        ImDrawIdx* dst_idx = draw_list->_IdxWritePtr;
+        for (unsigned int n = 0; n < cmd.ElemCount; n++)
+            dst_idx[n] = (ImDrawIdx)(src_idx[n] + vtx_base);
+        draw_list->_IdxWritePtr += cmd.ElemCount;
+        src_idx += cmd.ElemCount;
+    }
+    draw_list->_CmdHeader.ClipRect = region->DrawListClipRect;
+    draw_list->_OnChangedClipRect();
+    draw_list->_CmdHeader.TextureId = region->DrawListTextureId;
+    draw_list->_OnChangedTextureID();
+
+    // Apply the side effects the contents had on the window
+    window->DC.CursorMaxPos = start_pos + region->Size;
+    window->DC.IdealMaxPos = ImMax(window->DC.IdealMaxPos, region->IdealMaxPos);
+    window->DC.PrevLineTextBaseOffset = region->PrevLineTextBaseOffset;
+    window->DC.FocusCounterRegular += region->FocusCounterRegular;
+    window->DC.FocusCounterTabStop += region->FocusCounterTabStop;
+    window->DC.NavLayersActiveMaskNext |= region->NavLayersActiveMask;
+    if (region->NavId != 0 && region->NavId == g.NavId && g.NavWindow == window)
+    {
+        g.NavLayer = region->NavLayer;
+        g.NavFocusScopeId = region->NavFocusScopeId;
+        g.NavIdIsAlive = true;
+        window->NavRectRel[region->NavLayer] = region->NavRectRel;
+    }
+    return false;
+}
+
+// Copy the output of the contents, return false if it cannot be replayed as-is.
+static bool CachedRegionRecordDrawList(ImGuiCachedRegion* region, ImDrawList* draw_list)
+{
+    const int vtx_start = region->BackupVtxBufferSize;
+    const int idx_start = region->BackupIdxBufferSize;
+    const int idx_end = draw_list->IdxBuffer.Size;
+    if (draw_list->_Splitter._Current != region->BackupChannel || draw_list->_CmdHeader.VtxOffset != region->BackupVtxOffset)
+        return false;
+    if (sizeof(ImDrawIdx) == 2 && draw_list->VtxBuffer.Size - vtx_start >= (1 << 16))
+        return false;
+    if (memcmp(&draw_list->_CmdHeader.ClipRect, &region->DrawListClipRect, sizeof(ImVec4)) != 0 || draw_list->_CmdHeader.TextureId != region->DrawListTextureId)
+        return false;
+
+    int cmd_n = draw_list->CmdBuffer.Size - 1;
+    while (cmd_n > 0 && (int)draw_list->CmdBuffer[cmd_n].IdxOffset > idx_start)
+        cmd_n--;
+    region->CmdBuffer.resize(0);
+    for (; cmd_n < draw_list->CmdBuffer.Size; cmd_n++)
+    {
+        const ImDrawCmd* cmd = &draw_list->CmdBuffer[cmd_n];
+        if (cmd->UserCallback != NULL || cmd->VtxOffset != region->BackupVtxOffset)
+            return false;
+        const int cmd_idx_start = ImMax((int)cmd->IdxOffset, idx_start);
+        const int cmd_idx_end = ImMin((int)(cmd->IdxOffset + cmd->ElemCount), idx_end);
+        if (cmd_idx_end <= cmd_idx_start)
+            continue;
+        ImGuiCachedRegionCmd rec_cmd;
+        rec_cmd.ClipRect = cmd->ClipRect;
+        rec_cmd.TextureId = cmd->TextureId;
+        rec_cmd.ElemCount = (unsigned int)(cmd_idx_end - cmd_idx_start);
+        region->CmdBuffer.push_back(rec_cmd);
+    }
+
+    // Store indices relative to the first vertex of the region
+    const unsigned int idx_base = (unsigned int)vtx_start - draw_list->_CmdHeader.VtxOffset;
+    region->IdxBuffer.resize(idx_end - idx_start);
+    for (int n = 0; n < region->IdxBuffer.Size; n++)
+    {
+        const unsigned int idx = draw_list->IdxBuffer.Data[idx_start + n];
+        if (idx < idx_base)
+            return false;
+        region->IdxBuffer.Data[n] = (ImDrawIdx)(idx - idx_base);
+    }
+    region->VtxBuffer.resize(draw_list->VtxBuffer.Size - vtx_start);
+    memcpy(region->VtxBuffer.Data, draw_list->VtxBuffer.Data + vtx_start, (size_t)region->VtxBuffer.size_in_bytes());
+    return true;
+}
+
+void ImGui::EndCachedRegion()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    IM_ASSERT(g.CachedRegionsStack.Size > 0); // Mismatched BeginCachedRegion()/EndCachedRegion() calls
+
+    ImGuiCachedRegion* region = g.CachedRegions.GetByIndex(g.CachedRegionsStack.back());
+    IM_ASSERT(region->WindowID == window->ID); // EndCachedRegion() in wrong window?
+    g.CachedRegionsStack.pop_back();
+    if (region->IsReplaying)
+    {
+        region->IsReplaying = false;
+        EndGroup();
+        return;
+    }
+
+    const ImRect bb(region->StartPos, ImMax(window->DC.CursorMaxPos, region->StartPos));
+    region->Size = bb.GetSize();
+    region->IdealMaxPos = window->DC.IdealMaxPos;
+    region->PrevLineTextBaseOffset = window->DC.PrevLineTextBaseOffset;
+    region->FocusCounterRegular = window->DC.FocusCounterRegular - region->BackupFocusCounterRegular;
+    region->FocusCounterTabStop = window->DC.FocusCounterTabStop - region->BackupFocusCounterTabStop;
+    region->NavLayersActiveMask = window->DC.NavLayersActiveMaskNext;
+    window->DC.IdealMaxPos = ImMax(window->DC.IdealMaxPos, region->BackupIdealMaxPos);
+    window->DC.NavLayersActiveMaskNext |= region->BackupNavLayersActiveMask;
+
+    region->NavId = 0;
+    if (!region->BackupNavIdIsAlive && g.NavIdIsAlive)
+    {
+        region->NavLayer = g.NavLayer;
+        region->NavId = g.NavId;
+        region->NavFocusScopeId = g.NavFocusScopeId;
+        region->NavRectRel = window->NavRectRel[g.NavLayer];
+    }
+
+    // Don't keep output which depends on interactions (e.g. hovered colors), or which we wouldn't replay correctly
+    bool is_valid = !CachedRegionIsInteractedWith(window, bb) && g.WindowsActiveCount == region->BackupWindowsActiveCount;
+    is_valid = is_valid && g.TablesBeginCount == region->BackupTablesBeginCount && g.ColumnsBeginCount == region->BackupColumnsBeginCount;
+    is_valid = is_valid && g.CurrentTable == region->BackupCurrentTable && window->DC.CurrentColumns == region->BackupCurrentColumns;
+    if (is_valid && g.CurrentTable)
+        is_valid = g.CurrentTable->CurrentRow == region->BackupTableCurrentRow && g.CurrentTable->CurrentColumn == region->BackupTableCurrentColumn;
+    if (is_valid && window->DC.CurrentColumns)
+        is_valid = window->DC.CurrentColumns->Current == region->BackupColumnsCurrent;
+    is_valid = is_valid && (region->NavId == 0 || g.NavDisableHighlight);
+    region->IsValid = is_valid && CachedRegionRecordDrawList(region, window->DrawList);
+    if (!region->IsValid)
+    {
+        region->VtxBuffer.resize(0);
+        region->IdxBuffer.resize(0);
+        region->CmdBuffer.resize(0);
+    }
+    EndGroup();
+}
+
 
 //-----------------------------------------------------------------------------
 // [SECTION] SCROLLING
@@ -8695,6 +10355,18 @@ static bool ImGui::NavScoreItem(ImGuiNavItemData* result, ImRect cand)
     // For example, this ensure that items in one column are not reached when moving vertically from items in another column.
     NavClampRectToVisibleAreaForMoveDir(g.NavMoveClipDir, cand, window->ClipRect);
 
+#if !IMGUI_DEBUG_NAV_SCORING
+    // Early out: a candidate whose center lies behind the center of 'curr' can't end up in the quadrant we are moving to (see quadrant computation below),
+    // so unless the axial check may apply, it can't become a result. This is a cheap rejection of about half the items submitted during a move request.
+    if (g.NavLayer != ImGuiNavLayer_Menu || (g.NavWindow->Flags & ImGuiWindowFlags_ChildMenu))
+    {
+        if (g.NavMoveDir == ImGuiDir_Left  && cand.Min.x <= cand.Max.x && (cand.Min.x + cand.Max.x) > (curr.Min.x + curr.Max.x)) return false;
+        if (g.NavMoveDir == ImGuiDir_Right && cand.Min.x <= cand.Max.x && (cand.Min.x + cand.Max.x) < (curr.Min.x + curr.Max.x)) return false;
+        if (g.NavMoveDir == ImGuiDir_Up    && cand.Min.y <= cand.Max.y && (cand.Min.y + cand.Max.y) > (curr.Min.y + curr.Max.y)) return false;
+        if (g.NavMoveDir == ImGuiDir_Down  && cand.Min.y <= cand.Max.y && (cand.Min.y + cand.Max.y) < (curr.Min.y + curr.Max.y)) return false;
+    }
+#endif
+
     // Compute distance between boxes
     // FIXME-NAV: Introducing biases for vertical navigation, needs to be removed.
     float dbx = NavScoreItemDistInterval(cand.Min.x, cand.Max.x, curr.Min.x, curr.Max.x);
@@ -9046,6 +10718,7 @@ ImVec2 ImGui::GetNavInputAmount2d(ImGuiNavDirSourceFlags dir_sources, ImGuiInput
 
 static void ImGui::NavUpdate()
 {
+    IMGUI_PROFILER_SCOPE("NavUpdate", NULL, 0);
     ImGuiContext& g = *GImGui;
     ImGuiIO& io = g.IO;
 
@@ -10096,19 +11769,41 @@ void ImGui::EndDragDropTarget()
 // By default, tree nodes are automatically opened during logging.
 //-----------------------------------------------------------------------------
 
+// Write accumulated text to tty/file/callback
+static void LogFlush(ImGuiContext& g)
+{
+    if (g.LogBuffer.empty())
+        return;
+    if (g.LogCallback)
+        g.LogCallback(g.LogBuffer.begin(), g.LogBuffer.end(), g.LogCallbackUserData);
+    else if (g.LogFile)
+        ImFileWrite(g.LogBuffer.begin(), sizeof(char), (ImU64)g.LogBuffer.size(), g.LogFile);
+    else
+        return;
+    g.LogBuffer.Buf.resize(0);
+}
+
 // Pass text data straight to log (without being displayed)
 static inline void LogTextV(ImGuiContext& g, const char* fmt, va_list args)
 {
-    if (g.LogFile)
-    {
-        g.LogBuffer.Buf.resize(0);
-        g.LogBuffer.appendfv(fmt, args);
-        ImFileWrite(g.LogBuffer.c_str(), sizeof(char), (ImU64)g.LogBuffer.size(), g.LogFile);
-    }
-    else
-    {
-        g.LogBuffer.appendfv(fmt, args);
-    }
+    g.LogBuffer.appendfv(fmt, args);
+    if (g.LogBuffer.size() >= LOG_FLUSH_SIZE)
+        LogFlush(g);
+}
+
+// Pass text through without formatting
+static void LogTextRaw(ImGuiContext& g, const char* text, const char* text_end)
+{
+    g.LogBuffer.append(text, text_end);
+    if (g.LogBuffer.size() >= LOG_FLUSH_SIZE)
+        LogFlush(g);
+}
+
+static void LogTextIndent(ImGuiContext& g, int indentation)
+{
+    static const char spaces[] = "                                ";
+    for (; indentation > 0; indentation -= IM_ARRAYSIZE(spaces) - 1)
+        LogTextRaw(g, spaces, spaces + ImMin(indentation, IM_ARRAYSIZE(spaces) - 1));
 }
 
 void ImGui::LogText(const char* fmt, ...)
@@ -10152,7 +11847,7 @@ void ImGui::LogRenderedText(const ImVec2* ref_pos, const char* text, const char*
         g.LogLinePosY = ref_pos->y;
     if (log_new_line)
     {
-        LogText(IM_NEWLINE);
+        LogTextRaw(g, IM_NEWLINE, IM_NEWLINE + strlen(IM_NEWLINE));
         g.LogLineFirstItem = true;
     }
 
@@ -10176,11 +11871,12 @@ void ImGui::LogRenderedText(const ImVec2* ref_pos, const char* text, const char*
         {
             const int line_length = (int)(line_end - line_start);
             const int indentation = g.LogLineFirstItem ? tree_depth * 4 : 1;
-            LogText("%*s%.*s", indentation, "", line_length, line_start);
+            LogTextIndent(g, indentation);
+            LogTextRaw(g, line_start, line_start + line_length);
             g.LogLineFirstItem = false;
             if (*line_end == '\n')
             {
-                LogText(IM_NEWLINE);
+                LogTextRaw(g, IM_NEWLINE, IM_NEWLINE + strlen(IM_NEWLINE));
                 g.LogLineFirstItem = true;
             }
         }
@@ -10255,6 +11951,19 @@ void ImGui::LogToFile(int auto_open_depth, const char* filename)
     g.LogFile = f;
 }
 
+// Start logging/capturing text output to given callback
+void ImGui::LogToCallback(ImGuiLogCallback callback, void* user_data, int auto_open_depth)
+{
+    ImGuiContext& g = *GImGui;
+    if (g.LogEnabled)
+        return;
+    IM_ASSERT(callback != NULL);
+
+    LogBegin(ImGuiLogType_Callback, auto_open_depth);
+    g.LogCallback = callback;
+    g.LogCallbackUserData = user_data;
+}
+
 // Start logging/capturing text output to clipboard
 void ImGui::LogToClipboard(int auto_open_depth)
 {
@@ -10279,6 +11988,7 @@ void ImGui::LogFinish()
         return;
 
     LogText(IM_NEWLINE);
+    LogFlush(g);
     switch (g.LogType)
     {
     case ImGuiLogType_TTY:
@@ -10295,6 +12005,8 @@ void ImGui::LogFinish()
         if (!g.LogBuffer.empty())
             SetClipboardText(g.LogBuffer.begin());
         break;
+    case ImGuiLogType_Callback:
+        break;
     case ImGuiLogType_None:
         IM_ASSERT(0);
         break;
@@ -10303,6 +12015,8 @@ void ImGui::LogFinish()
     g.LogEnabled = false;
     g.LogType = ImGuiLogType_None;
     g.LogFile = NULL;
+    g.LogCallback = NULL;
+    g.LogCallbackUserData = NULL;
     g.LogBuffer.clear();
 }
 
@@ -10350,6 +12064,9 @@ void ImGui::LogButtons()
 // - LoadIniSettingsFromMemory()
 // - SaveIniSettingsToDisk()
 // - SaveIniSettingsToMemory()
+// - WriteIniSettingsFile()
+// - NotifyIniSettingsWriteCompleted()
+// - IniBinary***() [Internal]
 // - WindowSettingsHandler_***() [Internal]
 //-----------------------------------------------------------------------------
 
@@ -10367,13 +12084,14 @@ void ImGui::UpdateSettings()
     }
 
     // Save settings (with a delay after the last modification, so we don't spam disk too much)
-    if (g.SettingsDirtyTimer > 0.0f)
+    // Wait for any asynchronous write to complete before issuing a new one.
+    if (g.SettingsDirtyTimer > 0.0f && !g.SettingsIniWritePending)
     {
         g.SettingsDirtyTimer -= g.IO.DeltaTime;
         if (g.SettingsDirtyTimer <= 0.0f)
         {
             if (g.IO.IniFilename != NULL)
-                SaveIniSettingsToDisk(g.IO.IniFilename);
+                SaveIniSettingsToDiskEx(g.IO.IniFilename, g.IO.IniWriteAsyncFn != NULL);
             else
                 g.IO.WantSaveIniSettings = true;  // Let user know they can call SaveIniSettingsToMemory(). user will need to clear io.WantSaveIniSettings themselves.
             g.SettingsDirtyTimer = 0.0f;
@@ -10381,13 +12099,18 @@ void ImGui::UpdateSettings()
     }
 }
 
+// Mark all handlers which don't track their entries as modified (user code may use this to save custom handlers)
 void ImGui::MarkIniSettingsDirty()
 {
     ImGuiContext& g = *GImGui;
+    for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
+        if (g.SettingsHandlers[handler_n].WriteAllBinaryFn == NULL)
+            g.SettingsHandlers[handler_n].WriteCacheValid = g.SettingsHandlers[handler_n].WriteBinaryValid = false;
     if (g.SettingsDirtyTimer <= 0.0f)
         g.SettingsDirtyTimer = g.IO.IniSavingRate;
 }
 
+// Window settings entries are compared against their window on save (see WindowSettingsHandler_UpdateAll()), so we only need to start the timer.
 void ImGui::MarkIniSettingsDirty(ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
@@ -10396,9 +12119,30 @@ void ImGui::MarkIniSettingsDirty(ImGuiWindow* window)
             g.SettingsDirtyTimer = g.IO.IniSavingRate;
 }
 
+// Mark a single handler as modified: other handlers will reuse their previous output on the next save
+void ImGui::MarkIniSettingsDirty(ImGuiSettingsHandler* handler)
+{
+    ImGuiContext& g = *GImGui;
+    if (handler)
+        handler->WriteCacheValid = handler->WriteBinaryValid = false;
+    if (g.SettingsDirtyTimer <= 0.0f)
+        g.SettingsDirtyTimer = g.IO.IniSavingRate;
+}
+
+// Mark a single table settings entry as modified: other entries will reuse their previous output on the next save
+void ImGui::MarkIniSettingsDirty(ImGuiTableSettings* settings)
+{
+    ImGuiContext& g = *GImGui;
+    settings->WantSaveBinary = true;
+    settings->WriteCacheSize = 0;
+    if (g.SettingsDirtyTimer <= 0.0f)
+        g.SettingsDirtyTimer = g.IO.IniSavingRate;
+}
+
 ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_Settings);
 
 #if !IMGUI_DEBUG_INI_SETTINGS
     // Skip to the "###" marker if any. We don't skip past to match the behavior of GetID()
@@ -10413,6 +12157,7 @@ ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
     ImGuiWindowSettings* settings = g.SettingsWindows.alloc_chunk(chunk_size);
     IM_PLACEMENT_NEW(settings) ImGuiWindowSettings();
     settings->ID = ImHashStr(name, name_len);
+    settings->WantSaveBinary = true;
     memcpy(settings->GetName(), name, name_len + 1);   // Store with zero terminator
 
     return settings;
@@ -10448,9 +12193,14 @@ void ImGui::ClearIniSettings()
 {
     ImGuiContext& g = *GImGui;
     g.SettingsIniData.clear();
+    g.SettingsIniDataPrev.clear();
+    g.SettingsIniJournalSize = 0;
     for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
+    {
+        g.SettingsHandlers[handler_n].WriteCacheValid = g.SettingsHandlers[handler_n].WriteBinaryValid = false;
         if (g.SettingsHandlers[handler_n].ClearAllFn)
             g.SettingsHandlers[handler_n].ClearAllFn(&g, &g.SettingsHandlers[handler_n]);
+    }
 }
 
 void ImGui::LoadIniSettingsFromDisk(const char* ini_filename)
@@ -10467,10 +12217,26 @@ void ImGui::LoadIniSettingsFromDisk(const char* ini_filename)
 void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_Settings);
     IM_ASSERT(g.Initialized);
     //IM_ASSERT(!g.WithinFrameScope && "Cannot be called between NewFrame() and EndFrame()");
     //IM_ASSERT(g.SettingsLoaded == false && g.FrameCount == 0);
 
+    // Call pre-read handlers
+    // Some types will clear their data (e.g. dock information) some types will allow merge/override (window)
+    for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
+        if (g.SettingsHandlers[handler_n].ReadInitFn)
+            g.SettingsHandlers[handler_n].ReadInitFn(&g, &g.SettingsHandlers[handler_n]);
+
+    // Binary .ini data: entry records are read directly by their handler, text records of other handlers are parsed below
+    ImGuiTextBuffer binary_text_data;
+    if (IniBinaryIsValidHeader(ini_data, ini_size))
+    {
+        IniBinaryReadRecords(ini_data, ini_size, &binary_text_data);
+        ini_data = binary_text_data.c_str();
+        ini_size = (size_t)binary_text_data.size();
+    }
+
     // For user convenience, we allow passing a non zero-terminated string (hence the ini_size parameter).
     // For our convenience and to make the code simpler, we'll also write zero-terminators within the buffer. So let's create a writable copy..
     if (ini_size == 0)
@@ -10481,12 +12247,6 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
     memcpy(buf, ini_data, ini_size);
     buf_end[0] = 0;
 
-    // Call pre-read handlers
-    // Some types will clear their data (e.g. dock information) some types will allow merge/override (window)
-    for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
-        if (g.SettingsHandlers[handler_n].ReadInitFn)
-            g.SettingsHandlers[handler_n].ReadInitFn(&g, &g.SettingsHandlers[handler_n]);
-
     void* entry_data = NULL;
     ImGuiSettingsHandler* entry_handler = NULL;
 
@@ -10528,6 +12288,11 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
     // [DEBUG] Restore untouched copy so it can be browsed in Metrics (not strictly necessary)
     memcpy(buf, ini_data, ini_size);
 
+    // Loaded data replaced the output of previous saves
+    g.SettingsIniJournalSize = 0;
+    for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
+        g.SettingsHandlers[handler_n].WriteCacheValid = g.SettingsHandlers[handler_n].WriteBinaryValid = false;
+
     // Call post-read handlers
     for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
         if (g.SettingsHandlers[handler_n].ApplyAllFn)
@@ -10535,38 +12300,250 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
 }
 
 void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
+{
+    SaveIniSettingsToDiskEx(ini_filename, false);
+}
+
+// When 'async' is set, the data is handed to io.IniWriteAsyncFn(), otherwise it is written immediately.
+static void SaveIniSettingsToDiskEx(const char* ini_filename, bool async)
 {
     ImGuiContext& g = *GImGui;
     g.SettingsDirtyTimer = 0.0f;
     if (!ini_filename)
         return;
+    if (!async)
+        IniWaitPendingWrite();
+    IM_ASSERT(!g.SettingsIniWritePending && "Asynchronous .ini write in progress: call NotifyIniSettingsWriteCompleted() first!");
+    if (g.IO.IniSavingBinary)
+    {
+        SaveIniSettingsToDiskBinary(ini_filename, async);
+        return;
+    }
 
     size_t ini_data_size = 0;
-    const char* ini_data = SaveIniSettingsToMemory(&ini_data_size);
-    ImFileHandle f = ImFileOpen(ini_filename, "wt");
+    const char* ini_data = ImGui::SaveIniSettingsToMemory(&ini_data_size);
+    IniWriteFile(ini_filename, ini_data, ini_data_size, 0, async);
+}
+
+// Write .ini data to disk or hand a copy of it to io.IniWriteAsyncFn(). Returns false if a synchronous write failed.
+static bool IniWriteFile(const char* ini_filename, const char* ini_data, size_t ini_data_size, size_t append_offset, bool async)
+{
+    ImGuiContext& g = *GImGui;
+    if (!async)
+    {
+        if (ImGui::WriteIniSettingsFile(ini_filename, ini_data, ini_data_size, append_offset))
+            return true;
+        g.SettingsIniJournalSize = 0;
+        return false;
+    }
+    if (ini_data != g.SettingsIniWriteBuffer.Data)
+    {
+        g.SettingsIniWriteBuffer.resize((int)ini_data_size);
+        memcpy(g.SettingsIniWriteBuffer.Data, ini_data, ini_data_size);
+    }
+    g.SettingsIniWritePending = true;
+    g.IO.IniWriteAsyncFn(g.IO.IniWriteAsyncUserData, ini_filename, g.SettingsIniWriteBuffer.Data, ini_data_size, append_offset);
+    return true;
+}
+
+// Block until the write handed to io.IniWriteAsyncFn() is completed, e.g. before writing synchronously or destroying the context.
+static void IniWaitPendingWrite()
+{
+    ImGuiContext& g = *GImGui;
+    if (!g.SettingsIniWritePending)
+        return;
+    IM_ASSERT(g.IO.IniWriteAsyncWaitFn != NULL && "Need io.IniWriteAsyncWaitFn to wait for asynchronous .ini write!");
+    if (g.IO.IniWriteAsyncWaitFn)
+        ImGui::NotifyIniSettingsWriteCompleted(g.IO.IniWriteAsyncWaitFn(g.IO.IniWriteAsyncUserData));
+}
+
+// Doesn't access the context nor allocate memory, so it can be called from any thread (typically from your io.IniWriteAsyncFn implementation).
+// Unless appending, data is written to a temporary file which then replaces the destination, so an interrupted write can't leave a partial file.
+// When appending, the write fails if the file size doesn't match 'append_offset' (e.g. the file was modified or a previous write was lost).
+bool ImGui::WriteIniSettingsFile(const char* ini_filename, const char* ini_data, size_t ini_data_size, size_t append_offset)
+{
+    const bool append = (append_offset > 0);
+    const char* write_filename = ini_filename;
+#ifndef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
+    char tmp_filename[1024];
+    if (!append && ImFormatString(tmp_filename, IM_ARRAYSIZE(tmp_filename), "%s.tmp", ini_filename) < IM_ARRAYSIZE(tmp_filename) - 1)
+        write_filename = tmp_filename;
+#endif
+    ImFileHandle f = ImFileOpen(write_filename, append ? "ab" : IniBinaryIsValidHeader(ini_data, ini_data_size) ? "wb" : "wt");
     if (!f)
+        return false;
+    if (append && ImFileGetSize(f) != (ImU64)append_offset)
+    {
+        ImFileClose(f);
+        return false;
+    }
+    bool ret = (ImFileWrite(ini_data, sizeof(char), ini_data_size, f) == ini_data_size);
+    ret &= ImFileClose(f);
+#ifndef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
+    if (write_filename != ini_filename)
+        ret = ret && ImFileRename(write_filename, ini_filename);
+#endif
+    return ret;
+}
+
+void ImGui::NotifyIniSettingsWriteCompleted(bool success)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.SettingsIniWritePending && "No asynchronous .ini write in progress!");
+    g.SettingsIniWritePending = false;
+    if (success)
         return;
-    ImFileWrite(ini_data, sizeof(char), ini_data_size, f);
-    ImFileClose(f);
+
+    // Retry later, rewriting the binary file from scratch as the last write may be missing
+    g.SettingsIniJournalSize = 0;
+    if (g.SettingsDirtyTimer <= 0.0f)
+        g.SettingsDirtyTimer = g.IO.IniSavingRate;
 }
 
 // Call registered handlers (e.g. SettingsHandlerWindow_WriteAll() + custom handlers) to write their stuff into a text buffer
+// Handlers which haven't been marked dirty since the last save don't get called: their previous output is copied over.
+// Handlers tracking their entries (Window, Table) are always called, and copy over the previous output of unmodified entries.
 const char* ImGui::SaveIniSettingsToMemory(size_t* out_size)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_Settings);
     g.SettingsDirtyTimer = 0.0f;
+    g.SettingsIniData.Buf.swap(g.SettingsIniDataPrev.Buf);
     g.SettingsIniData.Buf.resize(0);
     g.SettingsIniData.Buf.push_back(0);
     for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
     {
         ImGuiSettingsHandler* handler = &g.SettingsHandlers[handler_n];
-        handler->WriteAllFn(&g, handler, &g.SettingsIniData);
+        const int write_offset = g.SettingsIniData.size();
+        if (handler->WriteCacheValid && handler->WriteAllBinaryFn == NULL)
+            g.SettingsIniData.append(g.SettingsIniDataPrev.begin() + handler->WriteCacheOffset, g.SettingsIniDataPrev.begin() + handler->WriteCacheOffset + handler->WriteCacheSize);
+        else
+            handler->WriteAllFn(&g, handler, &g.SettingsIniData);
+        handler->WriteCacheValid = true;
+        handler->WriteCacheOffset = write_offset;
+        handler->WriteCacheSize = g.SettingsIniData.size() - write_offset;
     }
     if (out_size)
         *out_size = (size_t)g.SettingsIniData.size();
     return g.SettingsIniData.c_str();
 }
 
+// Binary .ini format:
+// - Header: "ImGuiIni" + ImU32 version.
+// - Followed by records: ImU32 TypeHash, ImU32 EntryId, ImU32 DataSize, then DataSize bytes of data.
+// - Handlers providing ReadBinaryFn/WriteAllBinaryFn (Window, Table) store one record per entry, in a fixed binary layout.
+//   Other handlers store a single record with EntryId == 0, holding the text output of their WriteAllFn().
+// - Integers and floats are stored in native endianness. When an entry has multiple records, the last one wins.
+// This allows saving to only append records for modified entries. The file gets rewritten from scratch once it is
+// twice bigger than when it was last rewritten. A truncated last record (e.g. interrupted append) is ignored.
+static const char   IniBinaryMagic[8] = { 'I', 'm', 'G', 'u', 'i', 'I', 'n', 'i' };
+static const ImU32  IniBinaryVersion = 2;
+static const int    IniBinaryHeaderSize = 8 + 4;
+static const int    IniBinaryRecordHeaderSize = 4 + 4 + 4;
+
+static bool IniBinaryIsValidHeader(const char* data, size_t data_size)
+{
+    ImU32 version = 0;
+    if (data_size < (size_t)IniBinaryHeaderSize || memcmp(data, IniBinaryMagic, sizeof(IniBinaryMagic)) != 0)
+        return false;
+    memcpy(&version, data + sizeof(IniBinaryMagic), sizeof(version));
+    return version == IniBinaryVersion;
+}
+
+// Pass 1: find last record for each entry, pass 2: read them. Stop on first truncated record (e.g. interrupted append).
+static void IniBinaryReadRecords(const char* data, size_t data_size, ImGuiTextBuffer* out_text_buf)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiStorage last_records;
+    for (int pass = 0; pass < 2; pass++)
+        for (size_t offset = (size_t)IniBinaryHeaderSize; offset + IniBinaryRecordHeaderSize <= data_size; )
+        {
+            ImU32 record_header[3]; // TypeHash, EntryId, DataSize
+            memcpy(record_header, data + offset, IniBinaryRecordHeaderSize);
+            const ImU32 record_size = record_header[2];
+            if (record_size > data_size - offset - IniBinaryRecordHeaderSize) // Header fits (see loop condition), written this way so a corrupt size can't wrap around
+                break;
+            const ImGuiID record_key = ImHashData(&record_header[1], sizeof(ImU32), record_header[0]);
+            const char* record_data = data + offset + IniBinaryRecordHeaderSize;
+            offset += IniBinaryRecordHeaderSize + record_size;
+            if (pass == 0)
+            {
+                last_records.SetInt(record_key, (int)offset);
+                continue;
+            }
+            if (last_records.GetInt(record_key) != (int)offset)
+                continue;
+            if (record_header[1] == 0)
+                out_text_buf->append(record_data, record_data + record_size);
+            else
+                for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
+                    if (g.SettingsHandlers[handler_n].TypeHash == record_header[0] && g.SettingsHandlers[handler_n].ReadBinaryFn)
+                        g.SettingsHandlers[handler_n].ReadBinaryFn(&g, &g.SettingsHandlers[handler_n], record_header[1], record_data, (int)record_size);
+        }
+}
+
+// Append a binary .ini record to 'buf', return a pointer to its 'data_size' bytes of data to be filled by the caller
+char* ImGui::AppendIniBinaryRecord(ImVector<char>* buf, ImGuiID type_hash, ImGuiID entry_id, int data_size)
+{
+    IM_ASSERT(entry_id != 0 && "EntryId 0 is reserved for text records.");
+    const ImU32 record_header[3] = { type_hash, entry_id, (ImU32)data_size };
+    const int write_offset = buf->Size;
+    buf->resize(write_offset + IniBinaryRecordHeaderSize + data_size);
+    memcpy(buf->Data + write_offset, record_header, IniBinaryRecordHeaderSize);
+    return buf->Data + write_offset + IniBinaryRecordHeaderSize;
+}
+
+static void SaveIniSettingsToDiskBinary(const char* ini_filename, bool async)
+{
+    ImGuiContext& g = *GImGui;
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_Settings);
+
+    // Append modified entries to the file we previously wrote, unless it is due for compaction
+    const ImGuiID filename_id = ImHashStr(ini_filename);
+    const bool append = (g.SettingsIniJournalSize > 0 && g.SettingsIniJournalFilenameId == filename_id && g.SettingsIniJournalSize <= g.SettingsIniJournalLiveSize * 2);
+    ImVector<char>& buf = g.SettingsIniWriteBuffer;
+    buf.resize(0);
+    if (!append)
+    {
+        buf.resize(IniBinaryHeaderSize);
+        memcpy(buf.Data, IniBinaryMagic, sizeof(IniBinaryMagic));
+        memcpy(buf.Data + sizeof(IniBinaryMagic), &IniBinaryVersion, sizeof(IniBinaryVersion));
+    }
+
+    ImGuiTextBuffer text_buf;
+    for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
+    {
+        ImGuiSettingsHandler* handler = &g.SettingsHandlers[handler_n];
+        if (handler->WriteAllBinaryFn)
+        {
+            handler->WriteAllBinaryFn(&g, handler, &buf, append);
+        }
+        else if (!append || !handler->WriteBinaryValid)
+        {
+            text_buf.Buf.resize(0);
+            handler->WriteAllFn(&g, handler, &text_buf);
+            const int text_size = text_buf.size();
+            const ImU32 record_header[3] = { handler->TypeHash, 0, (ImU32)text_size };
+            const int write_offset = buf.Size;
+            buf.resize(write_offset + IniBinaryRecordHeaderSize + text_size);
+            memcpy(buf.Data + write_offset, record_header, IniBinaryRecordHeaderSize);
+            memcpy(buf.Data + write_offset + IniBinaryRecordHeaderSize, text_buf.begin(), (size_t)text_size);
+        }
+        handler->WriteBinaryValid = true;
+    }
+    if (append && buf.Size == 0)
+        return;
+
+    const size_t append_offset = append ? (size_t)g.SettingsIniJournalSize : 0;
+    g.SettingsIniJournalFilenameId = filename_id;
+    if (append)
+        g.SettingsIniJournalSize += buf.Size;
+    else
+        g.SettingsIniJournalSize = g.SettingsIniJournalLiveSize = buf.Size;
+    if (!IniWriteFile(ini_filename, buf.Data, (size_t)buf.Size, append_offset, async) && append)
+        SaveIniSettingsToDiskBinary(ini_filename, async); // File doesn't match what we previously wrote: rewrite it from scratch
+}
+
 static void WindowSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettingsHandler*)
 {
     ImGuiContext& g = *ctx;
@@ -10608,10 +12585,10 @@ static void WindowSettingsHandler_ApplyAll(ImGuiContext* ctx, ImGuiSettingsHandl
         }
 }
 
-static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+// Gather data from windows that were active during this session (if a window wasn't opened in this session we preserve its settings)
+// Entries which changed are marked for saving.
+static void WindowSettingsHandler_UpdateAll(ImGuiContext* ctx)
 {
-    // Gather data from windows that were active during this session
-    // (if a window wasn't opened in this session we preserve its settings)
     ImGuiContext& g = *ctx;
     for (int i = 0; i != g.Windows.Size; i++)
     {
@@ -10626,21 +12603,91 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
             window->SettingsOffset = g.SettingsWindows.offset_from_ptr(settings);
         }
         IM_ASSERT(settings->ID == window->ID);
-        settings->Pos = ImVec2ih((short)window->Pos.x, (short)window->Pos.y);
-        settings->Size = ImVec2ih((short)window->SizeFull.x, (short)window->SizeFull.y);
+        const ImVec2ih pos((short)window->Pos.x, (short)window->Pos.y);
+        const ImVec2ih size((short)window->SizeFull.x, (short)window->SizeFull.y);
+        if (settings->Pos.x == pos.x && settings->Pos.y == pos.y && settings->Size.x == size.x && settings->Size.y == size.y && settings->Collapsed == window->Collapsed)
+            continue;
+        settings->Pos = pos;
+        settings->Size = size;
         settings->Collapsed = window->Collapsed;
+        settings->WantSaveBinary = true;
+        settings->WriteCacheSize = 0;
     }
+}
+
+static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+{
+    ImGuiContext& g = *ctx;
+    WindowSettingsHandler_UpdateAll(ctx);
 
-    // Write to text buffer
+    // Write to text buffer, copying over output of the previous save for unmodified entries
+    const bool use_write_cache = (buf == &g.SettingsIniData);
+    const ImGuiTextBuffer& prev_buf = g.SettingsIniDataPrev;
     buf->reserve(buf->size() + g.SettingsWindows.size() * 6); // ballpark reserve
     for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
     {
+        const int write_offset = buf->size();
+        if (use_write_cache && handler->WriteCacheValid && settings->WriteCacheSize > 0 && settings->WriteCacheOffset + settings->WriteCacheSize <= prev_buf.size())
+        {
+            buf->append(prev_buf.begin() + settings->WriteCacheOffset, prev_buf.begin() + settings->WriteCacheOffset + settings->WriteCacheSize);
+        }
+        else
+        {
+            const char* settings_name = settings->GetName();
+            buf->appendf("[%s][%s]\n", handler->TypeName, settings_name);
+            buf->appendf("Pos=%d,%d\n", settings->Pos.x, settings->Pos.y);
+            buf->appendf("Size=%d,%d\n", settings->Size.x, settings->Size.y);
+            buf->appendf("Collapsed=%d\n", settings->Collapsed);
+            buf->append("\n");
+        }
+        if (use_write_cache)
+        {
+            settings->WriteCacheOffset = write_offset;
+            settings->WriteCacheSize = buf->size() - write_offset;
+        }
+    }
+}
+
+// Binary record: ImS16 Pos.x, Pos.y, Size.x, Size.y, ImU8 Collapsed, then the window name (without zero terminator)
+static void WindowSettingsHandler_ReadBinary(ImGuiContext* ctx, ImGuiSettingsHandler*, ImGuiID id, const char* data, int data_size)
+{
+    ImGuiContext& g = *ctx;
+    const int name_len = data_size - 9;
+    if (name_len < 0 || name_len >= IM_ARRAYSIZE(g.TempBuffer))
+        return;
+    ImGuiWindowSettings* settings = ImGui::FindWindowSettings(id);
+    if (!settings)
+    {
+        memcpy(g.TempBuffer, data + 9, (size_t)name_len);
+        g.TempBuffer[name_len] = 0;
+        settings = ImGui::CreateNewWindowSettings(g.TempBuffer);
+    }
+    *settings = ImGuiWindowSettings(); // Clear existing if recycling previous entry
+    settings->ID = id;
+    short values[4];
+    memcpy(values, data, sizeof(values));
+    settings->Pos = ImVec2ih(values[0], values[1]);
+    settings->Size = ImVec2ih(values[2], values[3]);
+    settings->Collapsed = (data[8] != 0);
+    settings->WantApply = true;
+}
+
+static void WindowSettingsHandler_WriteAllBinary(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImVector<char>* buf, bool modified_only)
+{
+    ImGuiContext& g = *ctx;
+    WindowSettingsHandler_UpdateAll(ctx);
+    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
+    {
+        if (modified_only && !settings->WantSaveBinary)
+            continue;
         const char* settings_name = settings->GetName();
-        buf->appendf("[%s][%s]\n", handler->TypeName, settings_name);
-        buf->appendf("Pos=%d,%d\n", settings->Pos.x, settings->Pos.y);
-        buf->appendf("Size=%d,%d\n", settings->Size.x, settings->Size.y);
-        buf->appendf("Collapsed=%d\n", settings->Collapsed);
-        buf->append("\n");
+        const int name_len = (int)strlen(settings_name);
+        const short values[4] = { settings->Pos.x, settings->Pos.y, settings->Size.x, settings->Size.y };
+        char* data = ImGui::AppendIniBinaryRecord(buf, handler->TypeHash, settings->ID, 9 + name_len);
+        memcpy(data, values, sizeof(values));
+        data[8] = settings->Collapsed ? 1 : 0;
+        memcpy(data + 9, settings_name, (size_t)name_len);
+        settings->WantSaveBinary = false;
     }
 }
 
@@ -10851,6 +12898,340 @@ static void ImeSetInputScreenPosFn_DefaultImpl(int, int) {}
 
 #endif
 
+//-----------------------------------------------------------------------------
+// [SECTION] FRAME PROFILER
+//-----------------------------------------------------------------------------
+// - ProfilerGetClockFrequency() [Internal]
+// - ProfilerGetTimeNs() [Internal]
+// - ProfilerContextHook() [Internal]
+// - ProfilerScopeBegin() [Internal]
+// - ProfilerScopeEnd() [Internal]
+// - ProfilerTraceContextHook() [Internal]
+// - ProfilerTraceToFile() [Internal]
+// - ProfilerTraceToCallback() [Internal]
+// - ProfilerTraceFinish() [Internal]
+//-----------------------------------------------------------------------------
+
+#ifdef IMGUI_ENABLE_PROFILER
+
+// Ticks per second of the clock read by ProfilerGetTimeNs(). Queried once by Initialize() rather than lazily, as contexts may be used from multiple threads.
+static ImU64 ProfilerGetClockFrequency()
+{
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+    LARGE_INTEGER frequency;
+    ::QueryPerformanceFrequency(&frequency);
+    return (ImU64)frequency.QuadPart;
+#elif defined(_WIN32)
+    return CLOCKS_PER_SEC;
+#else
+    return 1000000000;
+#endif
+}
+
+static ImU64 ProfilerGetTimeNs(const ImGuiProfiler* profiler)
+{
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+    const ImU64 frequency = profiler->ClockFrequency;
+    LARGE_INTEGER counter;
+    ::QueryPerformanceCounter(&counter);
+    return ((ImU64)counter.QuadPart / frequency) * 1000000000 + ((ImU64)counter.QuadPart % frequency) * 1000000000 / frequency;
+#elif defined(_WIN32)
+    IM_UNUSED(profiler);
+    return (ImU64)clock() * (1000000000 / CLOCKS_PER_SEC);
+#else
+    IM_UNUSED(profiler);
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ImU64)ts.tv_sec * 1000000000 + (ImU64)ts.tv_nsec;
+#endif
+}
+
+static void ProfilerScopeBeginEx(ImGuiProfiler* profiler, const char* name, const char* label, ImGuiID id)
+{
+    if (!profiler->Recording)
+        return;
+    ImGuiProfilerFrame* frame = &profiler->Frames[profiler->FrameIdx];
+    const ImU64 time = ProfilerGetTimeNs(profiler);
+
+    // Merge with previous call if it was the last scope completed under the same parent
+    int* last_sibling_idx = profiler->Stack.empty() ? &frame->LastRootIdx : &frame->Entries[profiler->Stack.back()].LastChildIdx;
+    int entry_idx = *last_sibling_idx;
+    ImGuiProfilerEntry* entry = (entry_idx != -1) ? &frame->Entries[entry_idx] : NULL;
+    if (entry == NULL || entry->Name != name || entry->Label != label || entry->ID != id)
+    {
+        entry_idx = frame->Entries.Size;
+        *last_sibling_idx = entry_idx;
+        frame->Entries.resize(frame->Entries.Size + 1);
+        entry = &frame->Entries.back();
+        entry->Name = name;
+        entry->Label = label;
+        entry->ID = id;
+        entry->Depth = profiler->Stack.Size;
+        entry->Count = 0;
+        entry->LastChildIdx = -1;
+        entry->TimeBegin = time;
+        entry->TimeTotal = 0;
+        frame->MaxDepth = ImMax(frame->MaxDepth, entry->Depth);
+    }
+    entry->TimeResumed = time;
+    profiler->Stack.push_back(entry_idx);
+}
+
+static void ProfilerScopeEndEx(ImGuiProfiler* profiler)
+{
+    if (!profiler->Recording || profiler->Stack.empty())
+        return;
+    ImGuiProfilerEntry* entry = &profiler->Frames[profiler->FrameIdx].Entries[profiler->Stack.back()];
+    entry->TimeEnd = ProfilerGetTimeNs(profiler);
+    entry->TimeTotal += entry->TimeEnd - entry->TimeResumed;
+    entry->Count++;
+    profiler->Stack.pop_back();
+}
+
+static void ProfilerFrameEnd(ImGuiProfiler* profiler)
+{
+    if (!profiler->Recording)
+        return;
+    while (!profiler->Stack.empty()) // Close scopes left open by mismatched Begin/End calls
+        ProfilerScopeEndEx(profiler);
+    profiler->Frames[profiler->FrameIdx].TimeEnd = ProfilerGetTimeNs(profiler);
+    profiler->FramesCount++;
+    profiler->Recording = false;
+}
+
+// Delimit frames and their NewFrame()/EndFrame()/Render() phases. Registered by Initialize().
+static void ProfilerContextHook(ImGuiContext* ctx, ImGuiContextHook* hook)
+{
+    ImGuiProfiler* profiler = &ctx->Profiler;
+    switch (hook->Type)
+    {
+    case ImGuiContextHookType_NewFramePre:
+        ProfilerFrameEnd(profiler); // Previous frame didn't call Render()
+        if (!profiler->Paused)
+        {
+            profiler->FrameIdx = (profiler->FrameIdx + 1) % IM_ARRAYSIZE(profiler->Frames);
+            profiler->FramesCount = ImMin(profiler->FramesCount, IM_ARRAYSIZE(profiler->Frames) - 1);
+            ImGuiProfilerFrame* frame = &profiler->Frames[profiler->FrameIdx];
+            frame->FrameCount = ctx->FrameCount + 1;
+            frame->MaxDepth = 0;
+            frame->LastRootIdx = -1;
+            frame->TimeBegin = frame->TimeEnd = ProfilerGetTimeNs(profiler);
+            frame->Entries.resize(0);
+            profiler->Recording = true;
+        }
+        profiler->PhaseStackSize = profiler->Stack.Size;
+        ProfilerScopeBeginEx(profiler, "NewFrame", NULL, 0);
+        break;
+    case ImGuiContextHookType_EndFramePre:
+        profiler->PhaseStackSize = profiler->Stack.Size;
+        ProfilerScopeBeginEx(profiler, "EndFrame", NULL, 0);
+        break;
+    case ImGuiContextHookType_RenderPre:
+        profiler->PhaseStackSize = profiler->Stack.Size;
+        ProfilerScopeBeginEx(profiler, "Render", NULL, 0);
+        break;
+    case ImGuiContextHookType_NewFramePost:
+    case ImGuiContextHookType_EndFramePost:
+    case ImGuiContextHookType_RenderPost:
+        while (profiler->Stack.Size > profiler->PhaseStackSize) // Also close scopes crossing the phase boundary (e.g. implicit "Debug" window)
+            ProfilerScopeEndEx(profiler);
+        if (hook->Type == ImGuiContextHookType_RenderPost)
+            ProfilerFrameEnd(profiler);
+        break;
+    default:
+        break;
+    }
+}
+
+void ImGui::ProfilerScopeBegin(const char* name, const char* label, ImGuiID id)
+{
+    ImGuiContext& g = *GImGui;
+    ProfilerScopeBeginEx(&g.Profiler, name, label, id);
+}
+
+void ImGui::ProfilerScopeEnd()
+{
+    ImGuiContext& g = *GImGui;
+    ProfilerScopeEndEx(&g.Profiler);
+}
+
+static ImGuiProfilerFrame* ProfilerGetCompleteFrame(ImGuiProfiler* profiler, int frames_ago)
+{
+    const int frames_size = IM_ARRAYSIZE(profiler->Frames);
+    const int last_idx = profiler->Recording ? profiler->FrameIdx - 1 : profiler->FrameIdx;
+    return &profiler->Frames[((last_idx - frames_ago) % frames_size + frames_size) % frames_size];
+}
+
+// Append string contents escaped for JSON
+static void ProfilerTraceAppendEscaped(ImGuiTextBuffer* buf, const char* s)
+{
+    const char* run = s;
+    for (; *s; s++)
+    {
+        const unsigned char c = (unsigned char)*s;
+        if (c >= 0x20 && c != '"' && c != '\\')
+            continue;
+        buf->append(run, s);
+        if (c == '"' || c == '\\')
+        {
+            const char escaped[3] = { '\\', (char)c, 0 };
+            buf->append(escaped);
+        }
+        else
+        {
+            buf->appendf("\\u%04x", c);
+        }
+        run = s + 1;
+    }
+    buf->append(run, s);
+}
+
+static void ProfilerTraceBeginEvent(ImGuiProfiler* profiler, const char* name, const char* label, const char* phase, ImU64 time)
+{
+    ImGuiTextBuffer* buf = &profiler->TraceBuffer;
+    buf->append(profiler->TraceEventsCount++ > 0 ? ",\n{\"name\":\"" : "{\"name\":\"");
+    ProfilerTraceAppendEscaped(buf, name);
+    if (label)
+    {
+        buf->append(": ");
+        ProfilerTraceAppendEscaped(buf, label);
+    }
+    buf->appendf("\",\"cat\":\"imgui\",\"ph\":\"%s\",\"pid\":1,\"tid\":1,\"ts\":%.3f", phase, (double)time / 1000.0);
+}
+
+static void ProfilerTraceFlush(ImGuiProfiler* profiler)
+{
+    if (profiler->TraceBuffer.empty())
+        return;
+    if (profiler->TraceCallback)
+        profiler->TraceCallback(profiler->TraceBuffer.begin(), profiler->TraceBuffer.end(), profiler->TraceCallbackUserData);
+    else if (profiler->TraceFile)
+        ImFileWrite(profiler->TraceBuffer.begin(), 1, (ImU64)profiler->TraceBuffer.size(), profiler->TraceFile);
+    profiler->TraceBuffer.Buf.resize(0);
+}
+
+// Write the last recorded frame as trace events: one complete ("X") event per profiler entry, nested by time
+// under a "Frame" event, followed by counter ("C") events. Registered for NewFramePre (in case Render() wasn't
+// called) and RenderPost, after ProfilerContextHook() which ends the frame. Paused frames are not written.
+static void ProfilerTraceContextHook(ImGuiContext* ctx, ImGuiContextHook* hook)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiProfiler* profiler = &g.Profiler;
+    if (profiler->FramesCount == 0)
+        return;
+    const ImGuiProfilerFrame* frame = ProfilerGetCompleteFrame(profiler, 0);
+    if (frame->FrameCount <= profiler->TraceLastFrameCount)
+        return;
+    profiler->TraceLastFrameCount = frame->FrameCount;
+
+    ProfilerTraceBeginEvent(profiler, "Frame", NULL, "X", frame->TimeBegin);
+    profiler->TraceBuffer.appendf(",\"dur\":%.3f,\"args\":{\"frame\":%d}}", (double)(frame->TimeEnd - frame->TimeBegin) / 1000.0, frame->FrameCount);
+    for (int entry_n = 0; entry_n < frame->Entries.Size; entry_n++)
+    {
+        const ImGuiProfilerEntry* entry = &frame->Entries[entry_n];
+        ProfilerTraceBeginEvent(profiler, entry->Name, entry->Label, "X", entry->TimeBegin);
+        profiler->TraceBuffer.appendf(",\"dur\":%.3f,\"args\":{\"calls\":%d,\"total_us\":%.3f", (double)(entry->TimeEnd - entry->TimeBegin) / 1000.0, entry->Count, (double)entry->TimeTotal / 1000.0);
+        if (entry->ID != 0)
+            profiler->TraceBuffer.appendf(",\"id\":\"0x%08X\"", entry->ID);
+        profiler->TraceBuffer.append("}}");
+    }
+
+    // Counters. Draw data is only available when the frame called Render().
+    ImDrawData* draw_data = &g.Viewports[0]->DrawDataP;
+    if (hook->Type == ImGuiContextHookType_RenderPost && draw_data->Valid)
+    {
+        int cmds_count = 0;
+        for (int n = 0; n < draw_data->CmdListsCount; n++)
+            cmds_count += draw_data->CmdLists[n]->CmdBuffer.Size;
+        ProfilerTraceBeginEvent(profiler, "DrawData", NULL, "C", frame->TimeEnd);
+        profiler->TraceBuffer.appendf(",\"args\":{\"vertices\":%d,\"indices\":%d,\"commands\":%d,\"lists\":%d}}", draw_data->TotalVtxCount, draw_data->TotalIdxCount, cmds_count, draw_data->CmdListsCount);
+    }
+    int window_storage_size = 0;
+    for (int n = 0; n < g.Windows.Size; n++)
+        window_storage_size += g.Windows[n]->StateStorage.Data.Size;
+    ProfilerTraceBeginEvent(profiler, "Storage", NULL, "C", frame->TimeEnd);
+    profiler->TraceBuffer.appendf(",\"args\":{\"windows_by_id\":%d,\"window_state\":%d}}", g.WindowsById.Data.Size, window_storage_size);
+    ProfilerTraceBeginEvent(profiler, "Memory", NULL, "C", frame->TimeEnd);
+    profiler->TraceBuffer.appendf(",\"args\":{\"active_allocations\":%d}}", g.IO.MetricsActiveAllocations);
+    ProfilerTraceFlush(profiler);
+}
+
+static void ProfilerTraceBegin(ImGuiContext& g)
+{
+    ImGuiProfiler* profiler = &g.Profiler;
+    profiler->TraceLastFrameCount = profiler->Recording ? g.FrameCount - 1 : g.FrameCount; // Start with the current or next frame
+    profiler->TraceBuffer.Buf.resize(0);
+    for (int n = 0; n < IM_ARRAYSIZE(profiler->TraceHookIds); n++)
+    {
+        ImGuiContextHook hook;
+        hook.Type = (n == 0) ? ImGuiContextHookType_NewFramePre : ImGuiContextHookType_RenderPost;
+        hook.Callback = ProfilerTraceContextHook;
+        profiler->TraceHookIds[n] = ImGui::AddContextHook(&g, &hook);
+    }
+
+    // JSON Array Format, with metadata naming our track
+    profiler->TraceBuffer.append("[\n");
+    profiler->TraceEventsCount = 1;
+    profiler->TraceBuffer.append("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"Dear ImGui\"}}");
+    ProfilerTraceFlush(profiler);
+}
+
+// Start streaming recorded frames to a file, in Chrome Trace Event JSON format.
+// Timestamps are from the same monotonic clock used by the profiler (QueryPerformanceCounter(), clock_gettime(CLOCK_MONOTONIC))
+// so they can be correlated with other traces recorded on the same machine.
+void ImGui::ProfilerTraceToFile(const char* filename)
+{
+    ImGuiContext& g = *GImGui;
+    if (g.Profiler.TraceHookIds[0] != 0)
+        return;
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+    {
+        IM_ASSERT(0);
+        return;
+    }
+    g.Profiler.TraceFile = f;
+    ProfilerTraceBegin(g);
+}
+
+void ImGui::ProfilerTraceToCallback(ImGuiLogCallback callback, void* user_data)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(callback != NULL);
+    if (g.Profiler.TraceHookIds[0] != 0)
+        return;
+    g.Profiler.TraceCallback = callback;
+    g.Profiler.TraceCallbackUserData = user_data;
+    ProfilerTraceBegin(g);
+}
+
+static void ProfilerTraceFinishEx(ImGuiContext* ctx)
+{
+    ImGuiProfiler* profiler = &ctx->Profiler;
+    if (profiler->TraceHookIds[0] == 0)
+        return;
+    for (int n = 0; n < IM_ARRAYSIZE(profiler->TraceHookIds); n++)
+    {
+        ImGui::RemoveContextHook(ctx, profiler->TraceHookIds[n]);
+        profiler->TraceHookIds[n] = 0;
+    }
+    profiler->TraceBuffer.append("\n]\n");
+    ProfilerTraceFlush(profiler);
+    profiler->TraceBuffer.clear();
+    if (profiler->TraceFile)
+        ImFileClose(profiler->TraceFile);
+    profiler->TraceFile = NULL;
+    profiler->TraceCallback = NULL;
+    profiler->TraceCallbackUserData = NULL;
+}
+
+void ImGui::ProfilerTraceFinish()
+{
+    ProfilerTraceFinishEx(GImGui);
+}
+
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
 //-----------------------------------------------------------------------------
 // [SECTION] METRICS/DEBUGGER WINDOW
 //-----------------------------------------------------------------------------
@@ -10867,6 +13248,7 @@ static void ImeSetInputScreenPosFn_DefaultImpl(int, int) {}
 // - DebugNodeWindow() [Internal]
 // - DebugNodeWindowSettings() [Internal]
 // - DebugNodeWindowsList() [Internal]
+// - DebugNodeProfiler() [Internal]
 //-----------------------------------------------------------------------------
 
 #ifndef IMGUI_DISABLE_METRICS_WINDOW
@@ -11166,6 +13548,60 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     }
 #endif // #ifdef IMGUI_HAS_DOCK
 
+#ifdef IMGUI_ENABLE_MEMORY_TAGS
+    // Memory accounting per tag
+    if (TreeNode("Memory"))
+    {
+        if (SmallButton("Reset peaks"))
+            ResetMemTagPeaks();
+        SameLine();
+        MetricsHelpMarker("Allocations made through IM_ALLOC() while this context was current, by subsystem. 'Total' counts allocations since startup, which helps spotting churn.");
+        if (BeginTable("##memtags", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit))
+        {
+            TableSetupColumn("Tag");
+            TableSetupColumn("Bytes");
+            TableSetupColumn("Peak bytes");
+            TableSetupColumn("Allocs");
+            TableSetupColumn("Peak allocs");
+            TableSetupColumn("Total allocs");
+            TableHeadersRow();
+            ImGuiMemTagStats sum;
+            for (int tag = 0; tag < ImGuiMemTag_COUNT; tag++)
+            {
+                const ImGuiMemTagStats* stats = &g.MemTagStats[tag];
+                TableNextRow();
+                TableNextColumn(); TextUnformatted(GetMemTagName(tag));
+                TableNextColumn(); Text("%.0f", (double)stats->Bytes);
+                TableNextColumn(); Text("%.0f", (double)stats->BytesPeak);
+                TableNextColumn(); Text("%d", stats->Count);
+                TableNextColumn(); Text("%d", stats->CountPeak);
+                TableNextColumn(); Text("%.0f", (double)stats->CountTotal);
+                sum.Bytes += stats->Bytes;
+                sum.Count += stats->Count;
+                sum.CountTotal += stats->CountTotal;
+            }
+            TableNextRow();
+            TableNextColumn(); TextUnformatted("(All)");
+            TableNextColumn(); Text("%.0f", (double)sum.Bytes);
+            TableNextColumn();
+            TableNextColumn(); Text("%d", sum.Count);
+            TableNextColumn();
+            TableNextColumn(); Text("%.0f", (double)sum.CountTotal);
+            EndTable();
+        }
+        TreePop();
+    }
+#endif
+
+#ifdef IMGUI_ENABLE_PROFILER
+    // Frame profiler
+    if (TreeNode("Profiler"))
+    {
+        DebugNodeProfiler(&g.Profiler);
+        TreePop();
+    }
+#endif
+
     // Settings
     if (TreeNode("Settings"))
     {
@@ -11183,10 +13619,12 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         else
             TextUnformatted("<NULL>");
         Text("SettingsDirtyTimer %.2f", g.SettingsDirtyTimer);
+        if (g.IO.IniSavingBinary)
+            Text("SettingsIniJournalSize %d bytes", g.SettingsIniJournalSize);
         if (TreeNode("SettingsHandlers", "Settings handlers: (%d)", g.SettingsHandlers.Size))
         {
             for (int n = 0; n < g.SettingsHandlers.Size; n++)
-                BulletText("%s", g.SettingsHandlers[n].TypeName);
+                BulletText("%s%s", g.SettingsHandlers[n].TypeName, g.SettingsHandlers[n].WriteCacheValid ? "" : " (modified)");
             TreePop();
         }
         if (TreeNode("SettingsWindows", "Settings packed data: Windows: %d bytes", g.SettingsWindows.size()))
@@ -11342,6 +13780,16 @@ void ImGui::DebugNodeColumns(ImGuiOldColumns* columns)
     TreePop();
 }
 
+// Offsets of commands may have been rebased by ImDrawData::MergeBuffers(): return the range of the command stored in this list
+static void DebugGetDrawCmdLocalRange(const ImDrawList* draw_list, const ImDrawCmd* draw_cmd, unsigned int* out_vtx_offset, unsigned int* out_idx_offset, unsigned int* out_elem_count)
+{
+    *out_vtx_offset = draw_cmd->VtxOffset - draw_list->_MergedVtxOffset;
+    *out_idx_offset = draw_cmd->IdxOffset - draw_list->_MergedIdxOffset;
+    *out_elem_count = draw_cmd->ElemCount;
+    if (draw_list->IdxBuffer.Size > 0)
+        *out_elem_count = ImMin(*out_elem_count, (unsigned int)draw_list->IdxBuffer.Size - ImMin(*out_idx_offset, (unsigned int)draw_list->IdxBuffer.Size));
+}
+
 // [DEBUG] Display contents of ImDrawList
 void ImGui::DebugNodeDrawList(ImGuiWindow* window, const ImDrawList* draw_list, const char* label)
 {
@@ -11371,6 +13819,11 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, const ImDrawList* draw_list,
 
     for (const ImDrawCmd* pcmd = draw_list->CmdBuffer.Data; pcmd < draw_list->CmdBuffer.Data + cmd_count; pcmd++)
     {
+        if (pcmd->UserCallback == ImDrawCallback_Shapes)
+        {
+            BulletText("Shapes:%5d, ClipRect (%4.0f,%4.0f)-(%4.0f,%4.0f)", pcmd->ShapeCount, pcmd->ClipRect.x, pcmd->ClipRect.y, pcmd->ClipRect.z, pcmd->ClipRect.w);
+            continue;
+        }
         if (pcmd->UserCallback)
         {
             BulletText("Callback %p, user_data %p", pcmd->UserCallback, pcmd->UserCallbackData);
@@ -11389,14 +13842,16 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, const ImDrawList* draw_list,
 
         // Calculate approximate coverage area (touched pixel count)
         // This will be in pixels squared as long there's no post-scaling happening to the renderer output.
+        unsigned int vtx_offset, idx_offset, elem_count;
+        DebugGetDrawCmdLocalRange(draw_list, pcmd, &vtx_offset, &idx_offset, &elem_count);
         const ImDrawIdx* idx_buffer = (draw_list->IdxBuffer.Size > 0) ? draw_list->IdxBuffer.Data : NULL;
-        const ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + pcmd->VtxOffset;
+        const ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + vtx_offset;
         float total_area = 0.0f;
-        for (unsigned int idx_n = pcmd->IdxOffset; idx_n < pcmd->IdxOffset + pcmd->ElemCount; )
+        for (unsigned int idx_n = idx_offset; idx_n < idx_offset + elem_count; )
         {
             ImVec2 triangle[3];
             for (int n = 0; n < 3; n++, idx_n++)
-                triangle[n] = vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n].pos;
+                triangle[n] = ImDrawVertGetPos(&vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n]);
             total_area += ImTriangleArea(triangle[0], triangle[1], triangle[2]);
         }
 
@@ -11408,18 +13863,19 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, const ImDrawList* draw_list,
 
         // Display individual triangles/vertices. Hover on to get the corresponding triangle highlighted.
         ImGuiListClipper clipper;
-        clipper.Begin(pcmd->ElemCount / 3); // Manually coarse clip our print out of individual vertices to save CPU, only items that may be visible.
+        clipper.Begin(elem_count / 3); // Manually coarse clip our print out of individual vertices to save CPU, only items that may be visible.
         while (clipper.Step())
-            for (int prim = clipper.DisplayStart, idx_i = pcmd->IdxOffset + clipper.DisplayStart * 3; prim < clipper.DisplayEnd; prim++)
+            for (int prim = clipper.DisplayStart, idx_i = idx_offset + clipper.DisplayStart * 3; prim < clipper.DisplayEnd; prim++)
             {
                 char* buf_p = buf, * buf_end = buf + IM_ARRAYSIZE(buf);
                 ImVec2 triangle[3];
                 for (int n = 0; n < 3; n++, idx_i++)
                 {
                     const ImDrawVert& v = vtx_buffer[idx_buffer ? idx_buffer[idx_i] : idx_i];
-                    triangle[n] = v.pos;
+                    const ImVec2 uv = ImDrawVertGetUV(&v);
+                    triangle[n] = ImDrawVertGetPos(&v);
                     buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n",
-                        (n == 0) ? "Vert:" : "     ", idx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
+                        (n == 0) ? "Vert:" : "     ", idx_i, triangle[n].x, triangle[n].y, uv.x, uv.y, v.col);
                 }
 
                 Selectable(buf, false);
@@ -11440,19 +13896,21 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, const ImDrawList* draw_list,
 void ImGui::DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList* out_draw_list, const ImDrawList* draw_list, const ImDrawCmd* draw_cmd, bool show_mesh, bool show_aabb)
 {
     IM_ASSERT(show_mesh || show_aabb);
+    unsigned int vtx_offset, idx_offset, elem_count;
+    DebugGetDrawCmdLocalRange(draw_list, draw_cmd, &vtx_offset, &idx_offset, &elem_count);
     ImDrawIdx* idx_buffer = (draw_list->IdxBuffer.Size > 0) ? draw_list->IdxBuffer.Data : NULL;
-    ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + draw_cmd->VtxOffset;
+    ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + vtx_offset;
 
     // Draw wire-frame version of all triangles
     ImRect clip_rect = draw_cmd->ClipRect;
     ImRect vtxs_rect(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
     ImDrawListFlags backup_flags = out_draw_list->Flags;
     out_draw_list->Flags &= ~ImDrawListFlags_AntiAliasedLines; // Disable AA on triangle outlines is more readable for very large and thin triangles.
-    for (unsigned int idx_n = draw_cmd->IdxOffset; idx_n < draw_cmd->IdxOffset + draw_cmd->ElemCount; )
+    for (unsigned int idx_n = idx_offset; idx_n < idx_offset + elem_count; )
     {
         ImVec2 triangle[3];
         for (int n = 0; n < 3; n++, idx_n++)
-            vtxs_rect.Add((triangle[n] = vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n].pos));
+            vtxs_rect.Add((triangle[n] = ImDrawVertGetPos(&vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n])));
         if (show_mesh)
             out_draw_list->AddPolyline(triangle, 3, IM_COL32(255, 255, 0, 255), ImDrawFlags_Closed, 1.0f); // In yellow: mesh triangles
     }
@@ -11708,6 +14166,91 @@ void ImGui::DebugNodeWindowsList(ImVector<ImGuiWindow*>* windows, const char* la
     TreePop();
 }
 
+#ifdef IMGUI_ENABLE_PROFILER
+static float ProfilerFrameTimeGetter(void* data, int idx)
+{
+    ImGuiProfiler* profiler = (ImGuiProfiler*)data;
+    const ImGuiProfilerFrame* frame = ProfilerGetCompleteFrame(profiler, profiler->FramesCount - 1 - idx); // Oldest first
+    return (float)(frame->TimeEnd - frame->TimeBegin) / 1000000.0f;
+}
+
+// Frame times history and flame graph of the selected frame
+void ImGui::DebugNodeProfiler(ImGuiProfiler* profiler)
+{
+    ImGuiContext& g = *GImGui;
+    Checkbox("Pause", &profiler->Paused);
+    SameLine();
+    if (profiler->TraceHookIds[0] == 0 ? SmallButton("Trace to \"imgui_trace.json\"") : SmallButton("Stop trace"))
+    {
+        if (profiler->TraceHookIds[0] == 0)
+            ProfilerTraceToFile("imgui_trace.json");
+        else
+            ProfilerTraceFinish();
+    }
+    SameLine();
+    MetricsHelpMarker("Frame times in milliseconds, from NewFrame() to the end of Render(). Click on the history to select a frame.\nConsecutive calls to the same scope are merged into one bar spanning from the first call to the last one, and the tooltip shows their total time.");
+    if (profiler->FramesCount == 0)
+    {
+        Text("No frame recorded yet.");
+        return;
+    }
+    profiler->SelectedFrame = ImClamp(profiler->SelectedFrame, 0, profiler->FramesCount - 1);
+
+    // Frame times (oldest on the left)
+    const int hovered_idx = PlotEx(ImGuiPlotType_Histogram, "##FrameTimes", ProfilerFrameTimeGetter, profiler, profiler->FramesCount, 0, NULL, 0.0f, FLT_MAX, ImVec2(-FLT_MIN, GetTextLineHeight() * 3.0f));
+    if (hovered_idx != -1 && IsMouseClicked(0))
+        profiler->SelectedFrame = profiler->FramesCount - 1 - hovered_idx;
+
+    ImGuiProfilerFrame* frame = ProfilerGetCompleteFrame(profiler, profiler->SelectedFrame);
+    const ImU64 frame_duration = ImMax(frame->TimeEnd - frame->TimeBegin, (ImU64)1);
+    Text("Frame %d: %.3f ms, %d scopes", frame->FrameCount, (double)frame_duration / 1000000.0, frame->Entries.Size);
+
+    // Flame graph
+    const float row_height = GetTextLineHeightWithSpacing();
+    InvisibleButton("##FlameGraph", ImVec2(ImMax(GetContentRegionAvail().x, 1.0f), row_height * (frame->MaxDepth + 1)));
+    const ImRect bb(GetItemRectMin(), GetItemRectMax());
+    const bool hovered = IsItemHovered();
+    const double scale = bb.GetWidth() / (double)frame_duration;
+    ImDrawList* draw_list = GetWindowDrawList();
+    const ImGuiProfilerEntry* hovered_entry = NULL;
+    char buf[128];
+    for (int entry_n = 0; entry_n < frame->Entries.Size; entry_n++)
+    {
+        const ImGuiProfilerEntry* entry = &frame->Entries[entry_n];
+        const float x1 = bb.Min.x + (float)((double)(entry->TimeBegin - frame->TimeBegin) * scale);
+        const float x2 = ImMax(bb.Min.x + (float)((double)(entry->TimeEnd - frame->TimeBegin) * scale), x1 + 1.0f);
+        const float y1 = bb.Min.y + entry->Depth * row_height;
+        const ImRect entry_bb(x1, y1, x2, y1 + row_height - 1.0f);
+        if (!IsClippedEx(entry_bb, 0, false))
+        {
+            float r, gr, b;
+            ColorConvertHSVtoRGB((ImHashStr(entry->Name) & 0xFF) / 255.0f, 0.45f, 0.70f, r, gr, b);
+            draw_list->AddRectFilled(entry_bb.Min, entry_bb.Max, ColorConvertFloat4ToU32(ImVec4(r, gr, b, 1.0f)));
+            if (entry_bb.GetWidth() > g.FontSize * 2.0f)
+            {
+                ImFormatString(buf, IM_ARRAYSIZE(buf), entry->Label ? "%s: %s" : "%s", entry->Name, entry->Label);
+                RenderTextClipped(entry_bb.Min + ImVec2(2.0f, 0.0f), entry_bb.Max - ImVec2(2.0f, 0.0f), buf, NULL, NULL);
+            }
+        }
+        if (hovered && entry_bb.Contains(g.IO.MousePos))
+            hovered_entry = entry;
+    }
+    if (hovered_entry)
+    {
+        BeginTooltip();
+        Text("%s", hovered_entry->Name);
+        if (hovered_entry->Label)
+            Text("Label: '%s'", hovered_entry->Label);
+        if (hovered_entry->ID != 0)
+            Text("ID: 0x%08X", hovered_entry->ID);
+        Text("Total: %.3f ms (%d call%s)", (double)hovered_entry->TimeTotal / 1000000.0, hovered_entry->Count, hovered_entry->Count > 1 ? "s" : "");
+        if (hovered_entry->Count > 1)
+            Text("First call to last call: %.3f ms", (double)(hovered_entry->TimeEnd - hovered_entry->TimeBegin) / 1000000.0);
+        EndTooltip();
+    }
+}
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
 #else
 
 void ImGui::ShowMetricsWindow(bool*) {}
@@ -11722,6 +14265,9 @@ void ImGui::DebugNodeWindow(ImGuiWindow*, const char*) {}
 void ImGui::DebugNodeWindowSettings(ImGuiWindowSettings*) {}
 void ImGui::DebugNodeWindowsList(ImVector<ImGuiWindow*>*, const char*) {}
 void ImGui::DebugNodeViewport(ImGuiViewportP*) {}
+#ifdef IMGUI_ENABLE_PROFILER
+void ImGui::DebugNodeProfiler(ImGuiProfiler*) {}
+#endif
 
 #endif
 
@@ -28,7 +28,7 @@ Index of this file:
 // [SECTION] ImGuiStyle
 // [SECTION] ImGuiIO
 // [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload, ImGuiTableSortSpecs, ImGuiTableColumnSortSpecs)
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImGuiPlotStream, ImColor)
 // [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
 // [SECTION] Viewports (ImGuiViewportFlags, ImGuiViewport)
@@ -138,7 +138,8 @@ struct ImDrawData;                  // All draw command lists required to render
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
-struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawShape;                 // A single analytic shape instance (rectangle, circle or line), rendered by backends supporting ImGuiBackendFlags_RendererHasShapes
+struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default, 12 bytes with IMGUI_USE_COMPACT_DRAWVERT. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
 struct ImFontBuilderIO;             // Opaque interface to a font builder (stb_truetype or FreeType).
@@ -152,6 +153,7 @@ struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using cu
 struct ImGuiListClipper;            // Helper to manually clip large list of items
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame, used by IMGUI_ONCE_UPON_A_FRAME macro
 struct ImGuiPayload;                // User data payload for drag and drop operations
+struct ImGuiPlotStream;             // Helper to hold a fixed capacity ring buffer of values to plot while appending into it
 struct ImGuiSizeCallbackData;       // Callback data when using SetNextWindowSizeConstraints() (rare/advanced use)
 struct ImGuiStorage;                // Helper for key->value storage
 struct ImGuiStyle;                  // Runtime data for styling/colors
@@ -176,6 +178,7 @@ typedef int ImGuiMouseCursor;       // -> enum ImGuiMouseCursor_     // Enum: A
 typedef int ImGuiSortDirection;     // -> enum ImGuiSortDirection_   // Enum: A sorting direction (ascending or descending)
 typedef int ImGuiStyleVar;          // -> enum ImGuiStyleVar_        // Enum: A variable identifier for styling
 typedef int ImGuiTableBgTarget;     // -> enum ImGuiTableBgTarget_   // Enum: A color target for TableSetBgColor()
+typedef int ImDrawShapeType;        // -> enum ImDrawShapeType_      // Enum: A shape type for ImDrawShape
 typedef int ImDrawFlags;            // -> enum ImDrawFlags_          // Flags: for ImDrawList functions
 typedef int ImDrawListFlags;        // -> enum ImDrawListFlags_      // Flags: for ImDrawList instance
 typedef int ImFontAtlasFlags;       // -> enum ImFontAtlasFlags_     // Flags: for ImFontAtlas build
@@ -210,6 +213,7 @@ typedef int (*ImGuiInputTextCallback)(ImGuiInputTextCallbackData* data);    // C
 typedef void (*ImGuiSizeCallback)(ImGuiSizeCallbackData* data);             // Callback function for ImGui::SetNextWindowSizeConstraints()
 typedef void* (*ImGuiMemAllocFunc)(size_t sz, void* user_data);             // Function signature for ImGui::SetAllocatorFunctions()
 typedef void (*ImGuiMemFreeFunc)(void* ptr, void* user_data);               // Function signature for ImGui::SetAllocatorFunctions()
+typedef void (*ImGuiLogCallback)(const char* text, const char* text_end, void* user_data); // Callback function for ImGui::LogToCallback()
 
 // Character types
 // (we generally use UTF-8 encoded string in the API. This is storage specifically for a decoded character used for keyboard input and display)
@@ -430,6 +434,8 @@ namespace ImGui
     IMGUI_API void          Unindent(float indent_w = 0.0f);                                // move content position back to the left, by indent_w, or style.IndentSpacing if indent_w <= 0
     IMGUI_API void          BeginGroup();                                                   // lock horizontal starting position
     IMGUI_API void          EndGroup();                                                     // unlock horizontal starting position + capture the whole group bounding box into one "item" (so you can use IsItemHovered() or layout primitives such as SameLine() on whole group, etc.)
+    IMGUI_API bool          BeginCachedRegion(const char* str_id, ImU32 version);           // begin a group whose output is recorded and replayed while 'version' is unchanged and the region isn't interacted with. when returning false, don't submit the contents. see comments in imgui.cpp.
+    IMGUI_API void          EndCachedRegion();                                              // always call EndCachedRegion() after BeginCachedRegion(), regardless of its return value.
     IMGUI_API ImVec2        GetCursorPos();                                                 // cursor position in window coordinates (relative to window position)
     IMGUI_API float         GetCursorPosX();                                                //   (some functions are using window-relative coordinates, such as: GetCursorPos, GetCursorStartPos, GetContentRegionMax, GetWindowContentRegion* etc.
     IMGUI_API float         GetCursorPosY();                                                //    other functions such as GetCursorScreenPos or everything in ImDrawList::
@@ -614,10 +620,15 @@ namespace ImGui
 
     // Widgets: Data Plotting
     // - Consider using ImPlot (https://github.com/epezent/implot)
+    // - When there are more values than pixels, each pixel column displays the min/max of the values it covers, so peaks are never skipped.
+    //   Those are computed from a cache which is rebuilt every frame, unless you call SetNextPlotDataVersion() and don't change the version.
     IMGUI_API void          PlotLines(const char* label, const float* values, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(float));
     IMGUI_API void          PlotLines(const char* label, float(*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
     IMGUI_API void          PlotHistogram(const char* label, const float* values, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(float));
     IMGUI_API void          PlotHistogram(const char* label, float(*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
+    IMGUI_API void          PlotLines(const char* label, const ImGuiPlotStream& stream, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));  // plot a ring buffer you keep pushing to. newest values are on the right.
+    IMGUI_API void          PlotHistogram(const char* label, const ImGuiPlotStream& stream, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
+    IMGUI_API void          SetNextPlotDataVersion(ImU32 version);                              // declare that the values of the next plot are unchanged as long as the values pointer/user data, count and 'version' are unchanged. Increment 'version' whenever you modify the values.
 
     // Widgets: Value() Helpers.
     // - Those are merely shortcut to calling Text() with a format string. Output single value in "name: value" format (tip: freely declare more in your code to handle your types. you can add functions to the ImGui namespace)
@@ -766,8 +777,11 @@ namespace ImGui
 
     // Logging/Capture
     // - All text output from the interface can be captured into tty/file/clipboard. By default, tree nodes are automatically opened during logging.
+    // - Text logged to tty/file/callback is accumulated and written in large chunks, when enough was accumulated and on LogFinish().
+    // - The callback of LogToCallback() receives those chunks (not zero-terminated). The text isn't valid after it returns: copy it if you process it asynchronously.
     IMGUI_API void          LogToTTY(int auto_open_depth = -1);                                 // start logging to tty (stdout)
     IMGUI_API void          LogToFile(int auto_open_depth = -1, const char* filename = NULL);   // start logging to file
+    IMGUI_API void          LogToCallback(ImGuiLogCallback callback, void* user_data, int auto_open_depth = -1); // start logging to your own sink (e.g. a pipe or a queue consumed by another thread)
     IMGUI_API void          LogToClipboard(int auto_open_depth = -1);                           // start logging to OS clipboard
     IMGUI_API void          LogFinish();                                                        // stop logging (close file, etc.)
     IMGUI_API void          LogButtons();                                                       // helper to display buttons for logging to tty/file/clipboard
@@ -886,10 +900,13 @@ namespace ImGui
     // Settings/.Ini Utilities
     // - The disk functions are automatically called if io.IniFilename != NULL (default is "imgui.ini").
     // - Set io.IniFilename to NULL to load/save manually. Read io.WantSaveIniSettings description about handling .ini saving manually.
+    // - Binary .ini data (written when io.IniSavingBinary is set) is automatically detected when loading. Text .ini data can always be loaded.
     IMGUI_API void          LoadIniSettingsFromDisk(const char* ini_filename);                  // call after CreateContext() and before the first call to NewFrame(). NewFrame() automatically calls LoadIniSettingsFromDisk(io.IniFilename).
-    IMGUI_API void          LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size=0); // call after CreateContext() and before the first call to NewFrame() to provide .ini data from your own data source.
+    IMGUI_API void          LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size=0); // call after CreateContext() and before the first call to NewFrame() to provide .ini data from your own data source. ini_size is required for binary data.
     IMGUI_API void          SaveIniSettingsToDisk(const char* ini_filename);                    // this is automatically called (if io.IniFilename is not empty) a few seconds after any modification that should be reflected in the .ini file (and also by DestroyContext).
     IMGUI_API const char*   SaveIniSettingsToMemory(size_t* out_ini_size = NULL);               // return a zero-terminated string with the .ini data which you can save by your own mean. call when io.WantSaveIniSettings is set, then save data by your own mean and clear io.WantSaveIniSettings.
+    IMGUI_API bool          WriteIniSettingsFile(const char* ini_filename, const char* ini_data, size_t ini_data_size, size_t append_offset); // write data to disk, replacing the file in one step unless appending (append_offset > 0: expected file size, fails on mismatch). doesn't access the context: call from any thread to implement io.IniWriteAsyncFn.
+    IMGUI_API void          NotifyIniSettingsWriteCompleted(bool success = true);               // call once the write requested by io.IniWriteAsyncFn is completed. a failed write will be retried later.
 
     // Debug Utilities
     // - This is used by the IMGUI_CHECKVERSION() macro.
@@ -1407,7 +1424,8 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasGamepad            = 1 << 0,   // Backend Platform supports gamepad and currently has one connected.
     ImGuiBackendFlags_HasMouseCursors       = 1 << 1,   // Backend Platform supports honoring GetMouseCursor() value to change the OS cursor shape.
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if ImGuiConfigFlags_NavEnableSetMousePos is set).
-    ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3    // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasShapes     = 1 << 4    // Backend Renderer supports ImDrawCallback_Shapes commands. This enables ImDrawList::AddShapeXXX() functions to output compact ImDrawShape instances instead of triangles.
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -1790,6 +1808,7 @@ struct ImGuiIO
     float       IniSavingRate;                  // = 5.0f           // Minimum time between saving positions/sizes to .ini file, in seconds.
     const char* IniFilename;                    // = "imgui.ini"    // Path to .ini file. Set NULL to disable automatic .ini loading/saving, if e.g. you want to manually load/save from memory.
     const char* LogFilename;                    // = "imgui_log.txt"// Path to .log file (default parameter to ImGui::LogToFile when no file is specified).
+    bool        IniSavingBinary;                // = false          // Save .ini file in a compact binary journal format: only settings handlers which have been modified are appended to the file, which gets compacted when it grows too much.
     float       MouseDoubleClickTime;           // = 0.30f          // Time for a double-click, in seconds.
     float       MouseDoubleClickMaxDist;        // = 6.0f           // Distance threshold to stay in to validate a double-click, in pixels.
     float       MouseDragThreshold;             // = 6.0f           // Distance threshold before considering we are dragging.
@@ -1811,7 +1830,9 @@ struct ImGuiIO
     bool        ConfigDragClickToInputText;     // = false          // [BETA] Enable turning DragXXX widgets into text input with a simple mouse click-release (without moving). Not desirable on devices without a keyboard.
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // Enable allowing to move windows only when clicking on their title bar. Does not apply to windows without a title bar.
-    float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused, and period at which draw list buffers of visible windows are trimmed to their recent high-water mark. Set to -1.0f to disable.
+    int         ConfigMemoryCompactBudget;      // = 0              // Budget (in bytes) for transient buffers kept by unused windows. When exceeded, least recently used windows and their tables are freed first, without waiting for ConfigMemoryCompactTimer. Set to 0 to disable.
+    bool        ConfigInputTrickleEventQueue;   // = true           // When using the io.AddXXXEvent() functions: spread input events queued within a same frame over multiple frames, so e.g. a button down+up sequence submitted between two frames is seen as a click. Set to false to apply all queued events on the next frame.
 
     //------------------------------------------------------------------
     // Platform Functions
@@ -1831,6 +1852,21 @@ struct ImGuiIO
     void        (*SetClipboardTextFn)(void* user_data, const char* text);
     void*       ClipboardUserData;
 
+    // Optional: Write .ini file without stalling NewFrame(), e.g. from a worker thread (default to NULL: NewFrame() writes the file synchronously)
+    // Call ImGui::WriteIniSettingsFile() with the given parameters from any thread, then call ImGui::NotifyIniSettingsWriteCompleted() from your main thread.
+    // 'ini_data' stays valid until then, and no other write is issued meanwhile. SaveIniSettingsToDisk() and DestroyContext() always write synchronously:
+    // they first call IniWriteAsyncWaitFn() (required) which should block until the pending write is completed and return its success, instead of calling NotifyIniSettingsWriteCompleted().
+    void        (*IniWriteAsyncFn)(void* user_data, const char* ini_filename, const char* ini_data, size_t ini_data_size, size_t append_offset);
+    bool        (*IniWriteAsyncWaitFn)(void* user_data);
+    void*       IniWriteAsyncUserData;
+
+    // Optional: Merged draw data output, for renderer backends uploading all vertices/indices at once (requires ImGuiBackendFlags_RendererHasVtxOffset)
+    // Render() calls this for each ImDrawData, once TotalVtxCount/TotalIdxCount are known. Return true with destination buffers (e.g. mapped GPU memory) and
+    // Render() will copy all draw lists there with ImDrawData::MergeBuffers(). Your render function then needs to use ImDrawCmd::VtxOffset/IdxOffset as global offsets.
+    bool        (*RenderGetMergedBuffersFn)(void* user_data, ImDrawData* draw_data, void** out_vtx_dst, void** out_idx_dst);
+    void*       RenderGetMergedBuffersUserData;
+    bool        RenderMergeDrawCmds;            // = false          // When using RenderGetMergedBuffersFn: also call ImDrawData::MergeDrawCmds() to reduce the number of draw calls.
+
     // Optional: Notify OS Input Method Editor of the screen position of your cursor for text input position (e.g. when using Japanese/Chinese IME on Windows)
     // (default to use native imm32 api on Windows)
     void        (*ImeSetInputScreenPosFn)(int x, int y);
@@ -1852,6 +1888,16 @@ struct ImGuiIO
     float       NavInputs[ImGuiNavInput_COUNT]; // Gamepad inputs. Cleared back to zero by EndFrame(). Keyboard keys will be auto-mapped and be written here by NewFrame().
 
     // Functions
+    // - Input events are queued in submission order and applied to the state above by NewFrame(), see io.ConfigInputTrickleEventQueue.
+    // - Events don't carry a timestamp: they take effect on the frame which applies them, so durations (e.g. io.MouseDownDuration[], double-click time) are measured in frames, not from the actual event times.
+    // - Those functions queue into the context owning this io, which doesn't need to be the current context.
+    // - Prefer them over writing io.MousePos/MouseDown[]/KeysDown[] etc. directly if your application may run at a low frame rate, as the level state can't represent fast sequences.
+    //   Don't mix both approaches for a same input, as queued events are applied over whatever was written directly.
+    IMGUI_API void  AddMousePosEvent(float x, float y);         // Queue a mouse position update. Use -FLT_MAX,-FLT_MAX to signify no mouse (e.g. app not focused and not hovered)
+    IMGUI_API void  AddMouseButtonEvent(int button, bool down); // Queue a mouse button change (0=left, 1=right, 2=middle + extras)
+    IMGUI_API void  AddMouseWheelEvent(float wh_x, float wh_y); // Queue a mouse wheel update, accumulated into io.MouseWheelH/io.MouseWheel
+    IMGUI_API void  AddKeyEvent(int key_index, bool down);      // Queue a key change, using the same indices as io.KeysDown[]
+    IMGUI_API void  AddKeyModsEvent(ImGuiKeyModFlags mods);     // Queue a change of Ctrl/Shift/Alt/Super modifiers
     IMGUI_API void  AddInputCharacter(unsigned int c);          // Queue new character input
     IMGUI_API void  AddInputCharacterUTF16(ImWchar16 c);        // Queue new character input from an UTF-16 character, it can be a surrogate
     IMGUI_API void  AddInputCharactersUTF8(const char* str);    // Queue new characters input from an UTF-8 string
@@ -1900,8 +1946,9 @@ struct ImGuiIO
     float       NavInputsDownDuration[ImGuiNavInput_COUNT];
     float       NavInputsDownDurationPrev[ImGuiNavInput_COUNT];
     float       PenPressure;                    // Touch/Pen pressure (0.0f to 1.0f, should be >0.0f only when MouseDown[0] == true). Helper storage currently unused by Dear ImGui.
+    ImGuiContext* Ctx;                          // Parent context (NULL for an ImGuiIO instance not owned by a context, where AddInputCharacter() writes to InputQueueCharacters directly)
     ImWchar16   InputQueueSurrogate;            // For AddInputCharacterUTF16
-    ImVector<ImWchar> InputQueueCharacters;     // Queue of _characters_ input (obtained by platform backend). Fill using AddInputCharacter() helper.
+    ImVector<ImWchar> InputQueueCharacters;     // Characters input for the current frame (obtained by platform backend), applied by NewFrame() from the event queue. Fill using AddInputCharacter() helper.
 
     IMGUI_API   ImGuiIO();
 };
@@ -2005,7 +2052,7 @@ struct ImGuiTableSortSpecs
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImGuiPlotStream, ImColor)
 //-----------------------------------------------------------------------------
 
 // Helper: Unicode defines
@@ -2035,6 +2082,29 @@ struct ImGuiTextFilter
     void                Clear()          { InputBuf[0] = 0; Build(); }
     bool                IsActive() const { return !Filters.empty(); }
 
+    // Filtering large sets of zero-terminated strings (case-insensitive matching is ASCII-only, and uses SSE2 when available)
+    // - PassFilterItems(): write one result per item. Doesn't access the ImGui context nor allocate memory: you may split a large array into chunks processed by different threads.
+    // - FilterItems(): return indices of passing items. When the filter was only narrowed since the previous call (e.g. more characters typed), only previous matches are tested.
+    //   The cache is keyed on the 'items' pointer and count: call ClearItemsCache() if contents of the array changed.
+    IMGUI_API void      PassFilterItems(const char* const* items, int items_count, bool* out_pass) const;
+    IMGUI_API const ImVector<int>& FilterItems(const char* const* items, int items_count);
+    void                ClearItemsCache() { CacheItems = NULL; CacheItemsCount = 0; CacheIndices.resize(0); CacheInputBuf.resize(0); }
+
+    // Fuzzy matching with ranked results (e.g. for command palettes): the whole input is used as a single pattern (blanks ignored), which needs to be found as a subsequence of the item.
+    // - FuzzySearch(): keep the 'max_results' best scoring items in FuzzyResults[], sorted best first. Call it every frame: the search restarts when input, items or 'max_results' changed.
+    //   With 'items_per_call' > 0 only that many items are processed per call, spreading a large search over multiple frames. Returns true when the search is complete.
+    //   Partial results are available while searching, and Draw() displays the progress. FuzzyResults[] can be passed to ImGuiListClipper.
+    // - Call ClearFuzzyResults() if contents of the items array changed.
+    struct ImGuiTextFuzzyResult
+    {
+        int             Index;          // Index in items[]
+        int             Score;          // Higher is better
+    };
+    IMGUI_API bool      FuzzySearch(const char* const* items, int items_count, int max_results = 100, int items_per_call = 0);
+    bool                IsFuzzySearching() const { return FuzzyItemsDone < FuzzyItemsCount; }
+    float               GetFuzzyProgress() const { return (FuzzyItemsCount > 0) ? (float)FuzzyItemsDone / (float)FuzzyItemsCount : 1.0f; }
+    void                ClearFuzzyResults() { FuzzyItems = NULL; FuzzyItemsCount = FuzzyItemsDone = 0; FuzzyResults.resize(0); FuzzyHeap.resize(0); FuzzyInputBuf.resize(0); }
+
     // [Internal]
     struct ImGuiTextRange
     {
@@ -2049,6 +2119,17 @@ struct ImGuiTextFilter
     char                    InputBuf[256];
     ImVector<ImGuiTextRange>Filters;
     int                     CountGrep;
+    ImVector<int>           CacheIndices;       // FilterItems(): last result
+    ImVector<char>          CacheInputBuf;      // FilterItems(): InputBuf used for last result
+    const char* const*      CacheItems;
+    int                     CacheItemsCount;
+    ImVector<ImGuiTextFuzzyResult> FuzzyResults;   // FuzzySearch(): best results, sorted
+    ImVector<ImGuiTextFuzzyResult> FuzzyHeap;      // FuzzySearch(): best results, as a min-heap (worst result on top)
+    ImVector<char>          FuzzyInputBuf;      // FuzzySearch(): InputBuf used for current search
+    const char* const*      FuzzyItems;
+    int                     FuzzyItemsCount;
+    int                     FuzzyItemsDone;
+    int                     FuzzyMaxResults;
 };
 
 // Helper: Growable text buffer for logging/accumulating text
@@ -2166,6 +2247,25 @@ struct ImGuiListClipper
 #endif
 };
 
+// Helper: Fixed capacity ring buffer of values, to display with PlotLines()/PlotHistogram() while you keep appending to it.
+// - Push() writes directly into the storage, overwriting the oldest value once the capacity is reached. There's no copy on your side.
+// - Plotting a stream only processes the values pushed since the previous frame, making it cheap to monitor high frequency data.
+// - This is not thread-safe: if values are produced by another thread, protect Push() and the plot call with your own lock.
+struct ImGuiPlotStream
+{
+    ImVector<float>     Values;         // Storage, Values.Size is the capacity
+    ImU64               Count;          // Number of values pushed since construction (never decreases, so plots can tell which values are new)
+    ImU64               Start;          // Value of Count when Clear() was last called
+
+    ImGuiPlotStream(int capacity = 0)   { Count = Start = 0; SetCapacity(capacity); }
+    void                SetCapacity(int capacity)   { Values.resize(capacity); Clear(); }
+    int                 Capacity() const            { return Values.Size; }
+    void                Clear()                     { Start = Count; }
+    int                 Size() const                { return (Count - Start < (ImU64)Values.Size) ? (int)(Count - Start) : Values.Size; }
+    void                Push(float v)               { IM_ASSERT(Values.Size > 0); Values.Data[(int)(Count % (ImU64)Values.Size)] = v; Count++; }
+    float               operator[](int i) const     { IM_ASSERT(i >= 0 && i < Size()); return Values.Data[(int)((Count - (ImU64)Size() + (ImU64)i) % (ImU64)Values.Size)]; } // i-th oldest value
+};
+
 // Helpers macros to generate 32-bit encoded colors
 #ifdef IMGUI_USE_BGRA_PACKED_COLOR
 #define IM_COL32_R_SHIFT    16
@@ -2233,6 +2333,10 @@ typedef void (*ImDrawCallback)(const ImDrawList* parent_list, const ImDrawCmd* c
 // It is not done by default because they are many perfectly useful way of altering render state for imgui contents (e.g. changing shader/blending settings before an Image call).
 #define ImDrawCallback_ResetRenderState     (ImDrawCallback)(-1)
 
+// Special Draw callback value used by commands rendering ImDrawShape instances: ImDrawCmd::ShapeCount shapes starting at ImDrawList::ShapeBuffer[ImDrawCmd::ShapeOffset].
+// Those commands are only emitted when the renderer backend sets ImGuiBackendFlags_RendererHasShapes, and it needs to handle this special value.
+#define ImDrawCallback_Shapes               (ImDrawCallback)(-2)
+
 // Typically, 1 command = 1 GPU draw call (unless command is a callback)
 // - VtxOffset/IdxOffset: When 'io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset' is enabled,
 //   those fields allow us to render meshes larger than 64K vertices while keeping 16-bit indices.
@@ -2247,6 +2351,8 @@ struct ImDrawCmd
     unsigned int    ElemCount;          // 4    // Number of indices (multiple of 3) to be rendered as triangles. Vertices are stored in the callee ImDrawList's vtx_buffer[] array, indices in idx_buffer[].
     ImDrawCallback  UserCallback;       // 4-8  // If != NULL, call the function instead of rendering the vertices. clip_rect and texture_id will be set normally.
     void*           UserCallbackData;   // 4-8  // The draw callback code can access this.
+    unsigned int    ShapeOffset;        // 4    // ImDrawCallback_Shapes commands: start offset in shape buffer.
+    unsigned int    ShapeCount;         // 4    // ImDrawCallback_Shapes commands: number of shapes to be rendered. Shapes are stored in the callee ImDrawList's shape_buffer[] array.
 
     ImDrawCmd() { memset(this, 0, sizeof(*this)); } // Also ensure our padding fields are zeroed
 
@@ -2256,13 +2362,32 @@ struct ImDrawCmd
 
 // Vertex index, default to 16-bit
 // To allow large meshes with 16-bit indices: set 'io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset' and handle ImDrawCmd::VtxOffset in the renderer backend (recommended).
+// Renderers which can't offset vertices natively (no "base vertex" support) may still set the flag, and upload lists for which ImDrawList::IdxBufferNeeds32() returns true
+// with 32-bit indices produced by ImDrawList::CopyIdxBufferAs32(). This way only large meshes use 32-bit indices, chosen at runtime per draw list.
 // To use 32-bit indices: override with '#define ImDrawIdx unsigned int' in imconfig.h.
 #ifndef ImDrawIdx
 typedef unsigned short ImDrawIdx;
 #endif
 
 // Vertex layout
-#ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#if defined(IMGUI_USE_COMPACT_DRAWVERT)
+// Compact layout (12 bytes): position in signed fixed-point, UV in normalized unsigned 16-bit. See IMGUI_USE_COMPACT_DRAWVERT in imconfig.h.
+// Backends need to scale positions by IM_DRAWVERT_POS_TO_FLOAT (e.g. in their projection matrix) and read UV as normalized integers.
+#ifdef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#error "IMGUI_USE_COMPACT_DRAWVERT and IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT cannot be used together."
+#endif
+#ifndef IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS
+#define IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS    4
+#endif
+#define IM_DRAWVERT_POS_TO_FIXED                ((float)(1 << IMGUI_COMPACT_DRAWVERT_POS_FRAC_BITS))
+#define IM_DRAWVERT_POS_TO_FLOAT                (1.0f / IM_DRAWVERT_POS_TO_FIXED)
+struct ImDrawVert
+{
+    ImS16   pos[2];
+    ImU16   uv[2];
+    ImU32   col;
+};
+#elif !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImDrawVert
 {
     ImVec2  pos;
@@ -2277,6 +2402,43 @@ struct ImDrawVert
 IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT;
 #endif
 
+// Read/write ImDrawVert position and UV. Code accessing vertices should use those in order to support IMGUI_USE_COMPACT_DRAWVERT.
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+inline ImS16    ImDrawVertQuantizePos(float v)                        { v *= IM_DRAWVERT_POS_TO_FIXED; v = (v < -32768.0f) ? -32768.0f : (v > 32767.0f) ? 32767.0f : v; return (ImS16)((int)(v + 32768.5f) - 32768); }
+inline ImU16    ImDrawVertQuantizeUV(float v)                         { v = (v < 0.0f) ? 0.0f : (v > 1.0f) ? 1.0f : v; return (ImU16)(int)(v * 65535.0f + 0.5f); }
+inline void     ImDrawVertSetPos(ImDrawVert* vtx, float x, float y)   { vtx->pos[0] = ImDrawVertQuantizePos(x); vtx->pos[1] = ImDrawVertQuantizePos(y); }
+inline void     ImDrawVertSetUV(ImDrawVert* vtx, float u, float v)    { vtx->uv[0] = ImDrawVertQuantizeUV(u); vtx->uv[1] = ImDrawVertQuantizeUV(v); }
+inline ImVec2   ImDrawVertGetPos(const ImDrawVert* vtx)               { return ImVec2(vtx->pos[0] * IM_DRAWVERT_POS_TO_FLOAT, vtx->pos[1] * IM_DRAWVERT_POS_TO_FLOAT); }
+inline ImVec2   ImDrawVertGetUV(const ImDrawVert* vtx)                { return ImVec2(vtx->uv[0] * (1.0f / 65535.0f), vtx->uv[1] * (1.0f / 65535.0f)); }
+#else
+inline void     ImDrawVertSetPos(ImDrawVert* vtx, float x, float y)   { vtx->pos.x = x; vtx->pos.y = y; }
+inline void     ImDrawVertSetUV(ImDrawVert* vtx, float u, float v)    { vtx->uv.x = u; vtx->uv.y = v; }
+inline ImVec2   ImDrawVertGetPos(const ImDrawVert* vtx)               { return vtx->pos; }
+inline ImVec2   ImDrawVertGetUV(const ImDrawVert* vtx)                { return vtx->uv; }
+#endif
+inline void     ImDrawVertSetPos(ImDrawVert* vtx, const ImVec2& p)    { ImDrawVertSetPos(vtx, p.x, p.y); }
+inline void     ImDrawVertSetUV(ImDrawVert* vtx, const ImVec2& uv)    { ImDrawVertSetUV(vtx, uv.x, uv.y); }
+
+// Shape types for ImDrawShape
+enum ImDrawShapeType_
+{
+    ImDrawShapeType_Rect    = 0,    // Rectangle from P1 (upper-left) to P2 (lower-right), with all corners rounded by 'Rounding'
+    ImDrawShapeType_Circle  = 1,    // Circle centered on P1, with radius P2.x
+    ImDrawShapeType_Line    = 2     // Line from P1 to P2, 'Thickness' wide, with flat ends
+};
+
+// Analytic shape instance (32 bytes), output by ImDrawList::AddShapeXXX() functions when ImDrawListFlags_AllowShapes is set.
+// Renderers typically draw one quad per instance and evaluate the shape distance in the fragment shader, with 1 pixel of anti-aliasing
+// (matching the fringe of anti-aliased triangles). The outline of Rect/Circle shapes is centered on their edge.
+struct ImDrawShape
+{
+    ImVec2          P1, P2;             // See ImDrawShapeType_
+    float           Rounding;           // Rect: corner radius, already clamped to half the smallest side
+    float           Thickness;          // Rect/Circle: outline thickness, 0.0f when filled. Line: thickness.
+    ImU32           Col;
+    ImU32           Type;               // ImDrawShapeType_
+};
+
 // [Internal] For use by ImDrawList
 struct ImDrawCmdHeader
 {
@@ -2338,7 +2500,8 @@ enum ImDrawListFlags_
     ImDrawListFlags_AntiAliasedLines        = 1 << 0,  // Enable anti-aliased lines/borders (*2 the number of triangles for 1.0f wide line or lines thin enough to be drawn using textures, otherwise *3 the number of triangles)
     ImDrawListFlags_AntiAliasedLinesUseTex  = 1 << 1,  // Enable anti-aliased lines/borders using textures when possible. Require backend to render with bilinear filtering.
     ImDrawListFlags_AntiAliasedFill         = 1 << 2,  // Enable anti-aliased edge around filled shapes (rounded rectangles, circles).
-    ImDrawListFlags_AllowVtxOffset          = 1 << 3   // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_AllowVtxOffset          = 1 << 3,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_AllowShapes             = 1 << 4   // Can emit ImDrawCallback_Shapes commands from AddShapeXXX() functions. Set when 'ImGuiBackendFlags_RendererHasShapes' is enabled.
 };
 
 // Draw command list
@@ -2356,6 +2519,7 @@ struct ImDrawList
     ImVector<ImDrawCmd>     CmdBuffer;          // Draw commands. Typically 1 command = 1 GPU draw call, unless the command is a callback.
     ImVector<ImDrawIdx>     IdxBuffer;          // Index buffer. Each command consume ImDrawCmd::ElemCount of those
     ImVector<ImDrawVert>    VtxBuffer;          // Vertex buffer.
+    ImVector<ImDrawShape>   ShapeBuffer;        // Shape buffer. Each ImDrawCallback_Shapes command consume ImDrawCmd::ShapeCount of those
     ImDrawListFlags         Flags;              // Flags, you may poke into these to adjust anti-aliasing settings per-primitive.
 
     // [Internal, used while building lists]
@@ -2370,6 +2534,8 @@ struct ImDrawList
     ImDrawCmdHeader         _CmdHeader;         // [Internal] template of active commands. Fields should match those of CmdBuffer.back().
     ImDrawListSplitter      _Splitter;          // [Internal] for channels api (note: prefer using your own persistent instance of ImDrawListSplitter!)
     float                   _FringeScale;       // [Internal] anti-alias fringe is scaled by this value, this helps to keep things sharp while zooming at vertex buffer content
+    unsigned int            _MergedVtxOffset;   // [Internal] global vertex offset currently added to VtxOffset of all commands by ImDrawData::MergeBuffers()
+    unsigned int            _MergedIdxOffset;   // [Internal] global index offset currently added to IdxOffset of all commands by ImDrawData::MergeBuffers()
 
     // If you want to create ImDrawList instances, pass them ImGui::GetDrawListSharedData() or create and use your own ImDrawListSharedData (so you can use ImDrawList without ImGui)
     ImDrawList(const ImDrawListSharedData* shared_data) { memset(this, 0, sizeof(*this)); _Data = shared_data; }
@@ -2416,6 +2582,17 @@ struct ImDrawList
     IMGUI_API void  AddImageQuad(ImTextureID user_texture_id, const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, const ImVec2& uv1 = ImVec2(0, 0), const ImVec2& uv2 = ImVec2(1, 0), const ImVec2& uv3 = ImVec2(1, 1), const ImVec2& uv4 = ImVec2(0, 1), ImU32 col = IM_COL32_WHITE);
     IMGUI_API void  AddImageRounded(ImTextureID user_texture_id, const ImVec2& p_min, const ImVec2& p_max, const ImVec2& uv_min, const ImVec2& uv_max, ImU32 col, float rounding, ImDrawFlags flags = 0);
 
+    // Shape primitives
+    // - When the renderer backend supports it (ImGuiBackendFlags_RendererHasShapes), each of those outputs a single compact ImDrawShape instead
+    //   of tessellating into triangles, and the backend renders them analytically. Otherwise they call the regular AddXXX() functions.
+    // - Consecutive shapes sharing the same clipping rectangle are rendered in a single instanced draw call, but each switch between shapes and
+    //   other primitives creates a new draw command: use them for large numbers of consecutive primitives (e.g. markers of a scatter plot).
+    IMGUI_API void  AddShapeLine(const ImVec2& p1, const ImVec2& p2, ImU32 col, float thickness = 1.0f);
+    IMGUI_API void  AddShapeRect(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, float rounding = 0.0f, float thickness = 1.0f);
+    IMGUI_API void  AddShapeRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, float rounding = 0.0f);
+    IMGUI_API void  AddShapeCircle(const ImVec2& center, float radius, ImU32 col, float thickness = 1.0f);
+    IMGUI_API void  AddShapeCircleFilled(const ImVec2& center, float radius, ImU32 col);
+
     // Stateful path API, add points then finish with PathFillConvex() or PathStroke()
     inline    void  PathClear()                                                 { _Path.Size = 0; }
     inline    void  PathLineTo(const ImVec2& pos)                               { _Path.push_back(pos); }
@@ -2432,6 +2609,8 @@ struct ImDrawList
     IMGUI_API void  AddCallback(ImDrawCallback callback, void* callback_data);  // Your rendering function must check for 'UserCallback' in ImDrawCmd and call the function instead of rendering triangles.
     IMGUI_API void  AddDrawCmd();                                               // This is useful if you need to forcefully create a new draw call (to allow for dependent rendering / blending). Otherwise primitives are merged into the same draw-call as much as possible
     IMGUI_API ImDrawList* CloneOutput() const;                                  // Create a clone of the CmdBuffer/IdxBuffer/VtxBuffer.
+    IMGUI_API bool  IdxBufferNeeds32() const;                                   // Return true if commands use multiple vertex ranges (ImDrawCmd::VtxOffset > 0), which happens past 64K vertices with 16-bit indices.
+    IMGUI_API void  CopyIdxBufferAs32(unsigned int* idx_dst) const;            // Copy IdxBuffer.Size indices as 32-bit with ImDrawCmd::VtxOffset added, for renderers without "base vertex" support. See ImDrawIdx.
 
     // Advanced: Channels
     // - Use to split render into layers. By switching channels to can render out-of-order (e.g. submit FG primitives before BG primitives)
@@ -2451,7 +2630,7 @@ struct ImDrawList
     IMGUI_API void  PrimRect(const ImVec2& a, const ImVec2& b, ImU32 col);      // Axis aligned rectangle (composed of two triangles)
     IMGUI_API void  PrimRectUV(const ImVec2& a, const ImVec2& b, const ImVec2& uv_a, const ImVec2& uv_b, ImU32 col);
     IMGUI_API void  PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, const ImVec2& d, const ImVec2& uv_a, const ImVec2& uv_b, const ImVec2& uv_c, const ImVec2& uv_d, ImU32 col);
-    inline    void  PrimWriteVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)    { _VtxWritePtr->pos = pos; _VtxWritePtr->uv = uv; _VtxWritePtr->col = col; _VtxWritePtr++; _VtxCurrentIdx++; }
+    inline    void  PrimWriteVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)    { ImDrawVertSetPos(_VtxWritePtr, pos); ImDrawVertSetUV(_VtxWritePtr, uv); _VtxWritePtr->col = col; _VtxWritePtr++; _VtxCurrentIdx++; }
     inline    void  PrimWriteIdx(ImDrawIdx idx)                                     { *_IdxWritePtr = idx; _IdxWritePtr++; }
     inline    void  PrimVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)         { PrimWriteIdx((ImDrawIdx)_VtxCurrentIdx); PrimWriteVtx(pos, uv, col); } // Write vertex with unique index
 
@@ -2468,6 +2647,7 @@ struct ImDrawList
     IMGUI_API void  _OnChangedClipRect();
     IMGUI_API void  _OnChangedTextureID();
     IMGUI_API void  _OnChangedVtxOffset();
+    IMGUI_API void  _AddShape(ImDrawShapeType type, const ImVec2& p1, const ImVec2& p2, float rounding, float thickness, ImU32 col);
     IMGUI_API int   _CalcCircleAutoSegmentCount(float radius) const;
     IMGUI_API void  _PathArcToFastEx(const ImVec2& center, float radius, int a_min_sample, int a_max_sample, int a_step);
     IMGUI_API void  _PathArcToN(const ImVec2& center, float radius, float a_min, float a_max, int num_segments);
@@ -2486,12 +2666,15 @@ struct ImDrawData
     ImVec2          DisplayPos;             // Top-left position of the viewport to render (== top-left of the orthogonal projection matrix to use) (== GetMainViewport()->Pos for the main viewport, == (0.0) in most single-viewport applications)
     ImVec2          DisplaySize;            // Size of the viewport to render (== GetMainViewport()->Size for the main viewport, == io.DisplaySize in most single-viewport applications)
     ImVec2          FramebufferScale;       // Amount of pixels for each unit of DisplaySize. Based on io.DisplayFramebufferScale. Generally (1,1) on normal display, (2,2) on OSX with Retina display.
+    bool            BuffersMerged;          // Set by MergeBuffers(): all vertices/indices were copied into single buffers, ImDrawCmd::VtxOffset/IdxOffset are offsets from the start of those buffers.
 
     // Functions
     ImDrawData()    { Clear(); }
     void Clear()    { memset(this, 0, sizeof(*this)); }     // The ImDrawList are owned by ImGuiContext!
     IMGUI_API void  DeIndexAllBuffers();                    // Helper to convert all buffers from indexed to non-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
     IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
+    IMGUI_API void  MergeBuffers(ImDrawVert* vtx_dst, ImDrawIdx* idx_dst); // Helper to copy all vertices/indices into single buffers of TotalVtxCount/TotalIdxCount elements (e.g. mapped GPU memory) and rebase ImDrawCmd::VtxOffset/IdxOffset accordingly. Requires a renderer honoring VtxOffset. See io.RenderGetMergedBuffersFn.
+    IMGUI_API void  MergeDrawCmds(ImDrawIdx* idx_dst);      // Helper to merge consecutive compatible commands, including across lists, after MergeBuffers(). A merged command is stored in the list of its first command and may span indices of following lists.
 };
 
 //-----------------------------------------------------------------------------
@@ -2625,6 +2808,7 @@ struct ImFontAtlas
     // Helpers to retrieve list of common Unicode ranges (2 value per range, values are inclusive, zero-terminated list)
     // NB: Make sure that your string are UTF-8 and NOT in your local code page. In C++11, you can create UTF-8 string literal using the u8"Hello world" syntax. See FAQ for details.
     // NB: Consider using ImFontGlyphRangesBuilder to build glyph ranges from textual data.
+    // NB: Japanese and ChineseSimplifiedCommon ranges are unpacked on first call into storage owned by the atlas, so they stay valid as long as the atlas.
     IMGUI_API const ImWchar*    GetGlyphRangesDefault();                // Basic Latin, Extended Latin
     IMGUI_API const ImWchar*    GetGlyphRangesKorean();                 // Default + Korean characters
     IMGUI_API const ImWchar*    GetGlyphRangesJapanese();               // Default + Hiragana, Katakana, Half-Width, Selection of 2999 Ideographs
@@ -2661,7 +2845,7 @@ struct ImFontAtlas
     ImTextureID                 TexID;              // User data to refer to the texture once it has been uploaded to user's graphic systems. It is passed back to you during rendering via the ImDrawCmd structure.
     int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
     int                         TexGlyphPadding;    // Padding between glyphs within texture in pixels. Defaults to 1. If your rendering method doesn't rely on bilinear filtering you may set this to 0.
-    bool                        Locked;             // Marked as Locked by ImGui::NewFrame() so attempt to modify the atlas will assert.
+    bool                        Locked;             // Marked as Locked by ImGui::NewFrame() so attempt to modify the atlas will assert. Not done for an atlas shared between contexts (which may be used by several threads): set it yourself if needed.
 
     // [Internal]
     // NB: Access texture data via GetTexData*() calls! Which will setup a default font for you.
@@ -2676,6 +2860,8 @@ struct ImFontAtlas
     ImVector<ImFontAtlasCustomRect> CustomRects;    // Rectangles for packing custom texture data into the atlas.
     ImVector<ImFontConfig>      ConfigData;         // Configuration data
     ImVec4                      TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];  // UVs for baked anti-aliased lines
+    ImVector<ImWchar>           GlyphRangesJapaneseData;                // Storage for GetGlyphRangesJapanese(), not freed by Clear() as fonts may still refer to it
+    ImVector<ImWchar>           GlyphRangesChineseSimplifiedCommonData; // Storage for GetGlyphRangesChineseSimplifiedCommon()
 
     // [Internal] Font builder
     const ImFontBuilderIO*      FontBuilderIO;      // Opaque interface to a font builder (default to stb_truetype, can be changed to use FreeType by defining IMGUI_ENABLE_FREETYPE).
@@ -1617,6 +1617,20 @@ static void ShowDemoWindowWidgets()
         ImGui::PlotHistogram("Histogram", func, NULL, display_count, 0, NULL, -1.0f, 1.0f, ImVec2(0, 80));
         ImGui::Separator();
 
+        // Push values into a ImGuiPlotStream: it holds the last N values, and only values pushed since the
+        // previous frame are processed when plotting it, which is suitable for monitoring high frequency data.
+        static ImGuiPlotStream stream(10000);
+        static double stream_time = 0.0;
+        if (!animate || stream_time == 0.0)
+            stream_time = ImGui::GetTime();
+        while (stream_time < ImGui::GetTime()) // Create data at fixed 1 kHz rate for the demo
+        {
+            stream.Push(sinf((float)stream_time * 2.0f) * 0.8f + (float)((stream.Count * 7919) % 100) * 0.002f);
+            stream_time += 1.0f / 1000.0f;
+        }
+        ImGui::PlotLines("Stream", stream, "last 10 seconds", -1.0f, 1.0f, ImVec2(0, 80.0f));
+        ImGui::Separator();
+
         // Animate a simple progress bar
         static float progress = 0.0f, progress_dir = 1.0f;
         if (animate)
@@ -5721,6 +5735,7 @@ void ImGui::ShowAboutWindow(bool* p_open)
         if (io.ConfigWindowsResizeFromEdges)                            ImGui::Text("io.ConfigWindowsResizeFromEdges");
         if (io.ConfigWindowsMoveFromTitleBarOnly)                       ImGui::Text("io.ConfigWindowsMoveFromTitleBarOnly");
         if (io.ConfigMemoryCompactTimer >= 0.0f)                        ImGui::Text("io.ConfigMemoryCompactTimer = %.1f", io.ConfigMemoryCompactTimer);
+        if (io.ConfigMemoryCompactBudget > 0)                           ImGui::Text("io.ConfigMemoryCompactBudget = %d", io.ConfigMemoryCompactBudget);
         ImGui::Text("io.BackendFlags: 0x%08X", io.BackendFlags);
         if (io.BackendFlags & ImGuiBackendFlags_HasGamepad)             ImGui::Text(" HasGamepad");
         if (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors)        ImGui::Text(" HasMouseCursors");
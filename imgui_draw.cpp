@@ -401,6 +401,8 @@ void ImDrawListSharedData::SetCircleTessellationMaxError(float max_error)
 // Initialize before use in a new frame. We always have a command ready in the buffer.
 void ImDrawList::_ResetForNewFrame()
 {
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
+
     // Verify that the ImDrawCmd fields we want to memcmp() are contiguous in memory.
     // (those should be IM_STATIC_ASSERT() in theory but with our pre C++11 setup the whole check doesn't compile with GCC)
     IM_ASSERT(IM_OFFSETOF(ImDrawCmd, ClipRect) == 0);
@@ -410,6 +412,7 @@ void ImDrawList::_ResetForNewFrame()
     CmdBuffer.resize(0);
     IdxBuffer.resize(0);
     VtxBuffer.resize(0);
+    ShapeBuffer.resize(0);
     Flags = _Data->InitialFlags;
     memset(&_CmdHeader, 0, sizeof(_CmdHeader));
     _VtxCurrentIdx = 0;
@@ -421,6 +424,7 @@ void ImDrawList::_ResetForNewFrame()
     _Splitter.Clear();
     CmdBuffer.push_back(ImDrawCmd());
     _FringeScale = 1.0f;
+    _MergedVtxOffset = _MergedIdxOffset = 0;
 }
 
 void ImDrawList::_ClearFreeMemory()
@@ -428,6 +432,7 @@ void ImDrawList::_ClearFreeMemory()
     CmdBuffer.clear();
     IdxBuffer.clear();
     VtxBuffer.clear();
+    ShapeBuffer.clear();
     Flags = ImDrawListFlags_None;
     _VtxCurrentIdx = 0;
     _VtxWritePtr = NULL;
@@ -440,16 +445,44 @@ void ImDrawList::_ClearFreeMemory()
 
 ImDrawList* ImDrawList::CloneOutput() const
 {
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
     ImDrawList* dst = IM_NEW(ImDrawList(_Data));
     dst->CmdBuffer = CmdBuffer;
     dst->IdxBuffer = IdxBuffer;
     dst->VtxBuffer = VtxBuffer;
+    dst->ShapeBuffer = ShapeBuffer;
     dst->Flags = Flags;
+    dst->_MergedVtxOffset = _MergedVtxOffset;
+    dst->_MergedIdxOffset = _MergedIdxOffset;
     return dst;
 }
 
+// A list uses more than one vertex range when it grew past 64K vertices with 16-bit indices (see ImDrawListFlags_AllowVtxOffset).
+// Offsets are monotonic so checking the last command is enough.
+bool ImDrawList::IdxBufferNeeds32() const
+{
+    return CmdBuffer.Size > 0 && CmdBuffer.Data[CmdBuffer.Size - 1].VtxOffset != _MergedVtxOffset;
+}
+
+// Convert the index buffer to 32-bit indices relative to the start of VtxBuffer, so a renderer without "base vertex" support
+// (e.g. OpenGL ES, WebGL, OpenGL < 3.2) can still honor ImDrawCmd::VtxOffset. 'idx_dst' needs room for IdxBuffer.Size indices,
+// and ImDrawCmd::IdxOffset can be used as is to address them. Only lists for which IdxBufferNeeds32() returns true need this.
+void ImDrawList::CopyIdxBufferAs32(unsigned int* idx_dst) const
+{
+    for (int cmd_n = 0; cmd_n < CmdBuffer.Size; cmd_n++)
+    {
+        const ImDrawCmd& cmd = CmdBuffer.Data[cmd_n];
+        const unsigned int vtx_offset = cmd.VtxOffset - _MergedVtxOffset;
+        const ImDrawIdx* src = IdxBuffer.Data + (cmd.IdxOffset - _MergedIdxOffset);
+        unsigned int* dst = idx_dst + (cmd.IdxOffset - _MergedIdxOffset);
+        for (unsigned int n = 0; n < cmd.ElemCount; n++)
+            dst[n] = (unsigned int)src[n] + vtx_offset;
+    }
+}
+
 void ImDrawList::AddDrawCmd()
 {
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
     ImDrawCmd draw_cmd;
     draw_cmd.ClipRect = _CmdHeader.ClipRect;    // Same as calling ImDrawCmd_HeaderCopy()
     draw_cmd.TextureId = _CmdHeader.TextureId;
@@ -577,6 +610,7 @@ int ImDrawList::_CalcCircleAutoSegmentCount(float radius) const
 // Render-level scissoring. This is passed down to your render function but not used for CPU-side coarse clipping. Prefer using higher-level ImGui::PushClipRect() to affect logic (hit-testing and widget culling)
 void ImDrawList::PushClipRect(ImVec2 cr_min, ImVec2 cr_max, bool intersect_with_current_clip_rect)
 {
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
     ImVec4 cr(cr_min.x, cr_min.y, cr_max.x, cr_max.y);
     if (intersect_with_current_clip_rect)
     {
@@ -608,6 +642,7 @@ void ImDrawList::PopClipRect()
 
 void ImDrawList::PushTextureID(ImTextureID texture_id)
 {
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
     _TextureIdStack.push_back(texture_id);
     _CmdHeader.TextureId = texture_id;
     _OnChangedTextureID();
@@ -625,6 +660,8 @@ void ImDrawList::PopTextureID()
 // submit the intermediate results. PrimUnreserve() can be used to release unused allocations.
 void ImDrawList::PrimReserve(int idx_count, int vtx_count)
 {
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
+
     // Large mesh support (when enabled)
     IM_ASSERT_PARANOID(idx_count >= 0 && vtx_count >= 0);
     if (sizeof(ImDrawIdx) == 2 && (_VtxCurrentIdx + vtx_count >= (1 << 16)) && (Flags & ImDrawListFlags_AllowVtxOffset))
@@ -666,10 +703,10 @@ void ImDrawList::PrimRect(const ImVec2& a, const ImVec2& c, ImU32 col)
     ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
     _IdxWritePtr[0] = idx; _IdxWritePtr[1] = (ImDrawIdx)(idx+1); _IdxWritePtr[2] = (ImDrawIdx)(idx+2);
     _IdxWritePtr[3] = idx; _IdxWritePtr[4] = (ImDrawIdx)(idx+2); _IdxWritePtr[5] = (ImDrawIdx)(idx+3);
-    _VtxWritePtr[0].pos = a; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
-    _VtxWritePtr[1].pos = b; _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col;
-    _VtxWritePtr[2].pos = c; _VtxWritePtr[2].uv = uv; _VtxWritePtr[2].col = col;
-    _VtxWritePtr[3].pos = d; _VtxWritePtr[3].uv = uv; _VtxWritePtr[3].col = col;
+    ImDrawVertSetPos(&_VtxWritePtr[0], a); ImDrawVertSetUV(&_VtxWritePtr[0], uv); _VtxWritePtr[0].col = col;
+    ImDrawVertSetPos(&_VtxWritePtr[1], b); ImDrawVertSetUV(&_VtxWritePtr[1], uv); _VtxWritePtr[1].col = col;
+    ImDrawVertSetPos(&_VtxWritePtr[2], c); ImDrawVertSetUV(&_VtxWritePtr[2], uv); _VtxWritePtr[2].col = col;
+    ImDrawVertSetPos(&_VtxWritePtr[3], d); ImDrawVertSetUV(&_VtxWritePtr[3], uv); _VtxWritePtr[3].col = col;
     _VtxWritePtr += 4;
     _VtxCurrentIdx += 4;
     _IdxWritePtr += 6;
@@ -681,10 +718,10 @@ void ImDrawList::PrimRectUV(const ImVec2& a, const ImVec2& c, const ImVec2& uv_a
     ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
     _IdxWritePtr[0] = idx; _IdxWritePtr[1] = (ImDrawIdx)(idx+1); _IdxWritePtr[2] = (ImDrawIdx)(idx+2);
     _IdxWritePtr[3] = idx; _IdxWritePtr[4] = (ImDrawIdx)(idx+2); _IdxWritePtr[5] = (ImDrawIdx)(idx+3);
-    _VtxWritePtr[0].pos = a; _VtxWritePtr[0].uv = uv_a; _VtxWritePtr[0].col = col;
-    _VtxWritePtr[1].pos = b; _VtxWritePtr[1].uv = uv_b; _VtxWritePtr[1].col = col;
-    _VtxWritePtr[2].pos = c; _VtxWritePtr[2].uv = uv_c; _VtxWritePtr[2].col = col;
-    _VtxWritePtr[3].pos = d; _VtxWritePtr[3].uv = uv_d; _VtxWritePtr[3].col = col;
+    ImDrawVertSetPos(&_VtxWritePtr[0], a); ImDrawVertSetUV(&_VtxWritePtr[0], uv_a); _VtxWritePtr[0].col = col;
+    ImDrawVertSetPos(&_VtxWritePtr[1], b); ImDrawVertSetUV(&_VtxWritePtr[1], uv_b); _VtxWritePtr[1].col = col;
+    ImDrawVertSetPos(&_VtxWritePtr[2], c); ImDrawVertSetUV(&_VtxWritePtr[2], uv_c); _VtxWritePtr[2].col = col;
+    ImDrawVertSetPos(&_VtxWritePtr[3], d); ImDrawVertSetUV(&_VtxWritePtr[3], uv_d); _VtxWritePtr[3].col = col;
     _VtxWritePtr += 4;
     _VtxCurrentIdx += 4;
     _IdxWritePtr += 6;
@@ -695,10 +732,10 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
     ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
     _IdxWritePtr[0] = idx; _IdxWritePtr[1] = (ImDrawIdx)(idx+1); _IdxWritePtr[2] = (ImDrawIdx)(idx+2);
     _IdxWritePtr[3] = idx; _IdxWritePtr[4] = (ImDrawIdx)(idx+2); _IdxWritePtr[5] = (ImDrawIdx)(idx+3);
-    _VtxWritePtr[0].pos = a; _VtxWritePtr[0].uv = uv_a; _VtxWritePtr[0].col = col;
-    _VtxWritePtr[1].pos = b; _VtxWritePtr[1].uv = uv_b; _VtxWritePtr[1].col = col;
-    _VtxWritePtr[2].pos = c; _VtxWritePtr[2].uv = uv_c; _VtxWritePtr[2].col = col;
-    _VtxWritePtr[3].pos = d; _VtxWritePtr[3].uv = uv_d; _VtxWritePtr[3].col = col;
+    ImDrawVertSetPos(&_VtxWritePtr[0], a); ImDrawVertSetUV(&_VtxWritePtr[0], uv_a); _VtxWritePtr[0].col = col;
+    ImDrawVertSetPos(&_VtxWritePtr[1], b); ImDrawVertSetUV(&_VtxWritePtr[1], uv_b); _VtxWritePtr[1].col = col;
+    ImDrawVertSetPos(&_VtxWritePtr[2], c); ImDrawVertSetUV(&_VtxWritePtr[2], uv_c); _VtxWritePtr[2].col = col;
+    ImDrawVertSetPos(&_VtxWritePtr[3], d); ImDrawVertSetUV(&_VtxWritePtr[3], uv_d); _VtxWritePtr[3].col = col;
     _VtxWritePtr += 4;
     _VtxCurrentIdx += 4;
     _IdxWritePtr += 6;
@@ -846,8 +883,8 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 ImVec2 tex_uv1(tex_uvs.z, tex_uvs.w);
                 for (int i = 0; i < points_count; i++)
                 {
-                    _VtxWritePtr[0].pos = temp_points[i * 2 + 0]; _VtxWritePtr[0].uv = tex_uv0; _VtxWritePtr[0].col = col; // Left-side outer edge
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 1]; _VtxWritePtr[1].uv = tex_uv1; _VtxWritePtr[1].col = col; // Right-side outer edge
+                    ImDrawVertSetPos(&_VtxWritePtr[0], temp_points[i * 2 + 0]); ImDrawVertSetUV(&_VtxWritePtr[0], tex_uv0); _VtxWritePtr[0].col = col; // Left-side outer edge
+                    ImDrawVertSetPos(&_VtxWritePtr[1], temp_points[i * 2 + 1]); ImDrawVertSetUV(&_VtxWritePtr[1], tex_uv1); _VtxWritePtr[1].col = col; // Right-side outer edge
                     _VtxWritePtr += 2;
                 }
             }
@@ -856,9 +893,9 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 // If we're not using a texture, we need the center vertex as well
                 for (int i = 0; i < points_count; i++)
                 {
-                    _VtxWritePtr[0].pos = points[i];              _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;       // Center of line
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 0]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col_trans; // Left-side outer edge
-                    _VtxWritePtr[2].pos = temp_points[i * 2 + 1]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col_trans; // Right-side outer edge
+                    ImDrawVertSetPos(&_VtxWritePtr[0], points[i]);              ImDrawVertSetUV(&_VtxWritePtr[0], opaque_uv); _VtxWritePtr[0].col = col;       // Center of line
+                    ImDrawVertSetPos(&_VtxWritePtr[1], temp_points[i * 2 + 0]); ImDrawVertSetUV(&_VtxWritePtr[1], opaque_uv); _VtxWritePtr[1].col = col_trans; // Left-side outer edge
+                    ImDrawVertSetPos(&_VtxWritePtr[2], temp_points[i * 2 + 1]); ImDrawVertSetUV(&_VtxWritePtr[2], opaque_uv); _VtxWritePtr[2].col = col_trans; // Right-side outer edge
                     _VtxWritePtr += 3;
                 }
             }
@@ -926,10 +963,10 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             // Add vertices
             for (int i = 0; i < points_count; i++)
             {
-                _VtxWritePtr[0].pos = temp_points[i * 4 + 0]; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col_trans;
-                _VtxWritePtr[1].pos = temp_points[i * 4 + 1]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-                _VtxWritePtr[2].pos = temp_points[i * 4 + 2]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-                _VtxWritePtr[3].pos = temp_points[i * 4 + 3]; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col_trans;
+                ImDrawVertSetPos(&_VtxWritePtr[0], temp_points[i * 4 + 0]); ImDrawVertSetUV(&_VtxWritePtr[0], opaque_uv); _VtxWritePtr[0].col = col_trans;
+                ImDrawVertSetPos(&_VtxWritePtr[1], temp_points[i * 4 + 1]); ImDrawVertSetUV(&_VtxWritePtr[1], opaque_uv); _VtxWritePtr[1].col = col;
+                ImDrawVertSetPos(&_VtxWritePtr[2], temp_points[i * 4 + 2]); ImDrawVertSetUV(&_VtxWritePtr[2], opaque_uv); _VtxWritePtr[2].col = col;
+                ImDrawVertSetPos(&_VtxWritePtr[3], temp_points[i * 4 + 3]); ImDrawVertSetUV(&_VtxWritePtr[3], opaque_uv); _VtxWritePtr[3].col = col_trans;
                 _VtxWritePtr += 4;
             }
         }
@@ -954,10 +991,10 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             dx *= (thickness * 0.5f);
             dy *= (thickness * 0.5f);
 
-            _VtxWritePtr[0].pos.x = p1.x + dy; _VtxWritePtr[0].pos.y = p1.y - dx; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;
-            _VtxWritePtr[1].pos.x = p2.x + dy; _VtxWritePtr[1].pos.y = p2.y - dx; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-            _VtxWritePtr[2].pos.x = p2.x - dy; _VtxWritePtr[2].pos.y = p2.y + dx; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-            _VtxWritePtr[3].pos.x = p1.x - dy; _VtxWritePtr[3].pos.y = p1.y + dx; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col;
+            ImDrawVertSetPos(&_VtxWritePtr[0], p1.x + dy, p1.y - dx); ImDrawVertSetUV(&_VtxWritePtr[0], opaque_uv); _VtxWritePtr[0].col = col;
+            ImDrawVertSetPos(&_VtxWritePtr[1], p2.x + dy, p2.y - dx); ImDrawVertSetUV(&_VtxWritePtr[1], opaque_uv); _VtxWritePtr[1].col = col;
+            ImDrawVertSetPos(&_VtxWritePtr[2], p2.x - dy, p2.y + dx); ImDrawVertSetUV(&_VtxWritePtr[2], opaque_uv); _VtxWritePtr[2].col = col;
+            ImDrawVertSetPos(&_VtxWritePtr[3], p1.x - dy, p1.y + dx); ImDrawVertSetUV(&_VtxWritePtr[3], opaque_uv); _VtxWritePtr[3].col = col;
             _VtxWritePtr += 4;
 
             _IdxWritePtr[0] = (ImDrawIdx)(_VtxCurrentIdx); _IdxWritePtr[1] = (ImDrawIdx)(_VtxCurrentIdx + 1); _IdxWritePtr[2] = (ImDrawIdx)(_VtxCurrentIdx + 2);
@@ -1019,8 +1056,8 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
             dm_y *= AA_SIZE * 0.5f;
 
             // Add vertices
-            _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
-            _VtxWritePtr[1].pos.x = (points[i1].x + dm_x); _VtxWritePtr[1].pos.y = (points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
+            ImDrawVertSetPos(&_VtxWritePtr[0], (points[i1].x - dm_x), (points[i1].y - dm_y)); ImDrawVertSetUV(&_VtxWritePtr[0], uv); _VtxWritePtr[0].col = col;        // Inner
+            ImDrawVertSetPos(&_VtxWritePtr[1], (points[i1].x + dm_x), (points[i1].y + dm_y)); ImDrawVertSetUV(&_VtxWritePtr[1], uv); _VtxWritePtr[1].col = col_trans;  // Outer
             _VtxWritePtr += 2;
 
             // Add indexes for fringes
@@ -1038,7 +1075,7 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
         PrimReserve(idx_count, vtx_count);
         for (int i = 0; i < vtx_count; i++)
         {
-            _VtxWritePtr[0].pos = points[i]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
+            ImDrawVertSetPos(&_VtxWritePtr[0], points[i]); ImDrawVertSetUV(&_VtxWritePtr[0], uv); _VtxWritePtr[0].col = col;
             _VtxWritePtr++;
         }
         for (int i = 2; i < points_count; i++)
@@ -1052,6 +1089,7 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
 
 void ImDrawList::_PathArcToFastEx(const ImVec2& center, float radius, int a_min_sample, int a_max_sample, int a_step)
 {
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
     if (radius <= 0.0f)
     {
         _Path.push_back(center);
@@ -1144,6 +1182,7 @@ void ImDrawList::_PathArcToFastEx(const ImVec2& center, float radius, int a_min_
 
 void ImDrawList::_PathArcToN(const ImVec2& center, float radius, float a_min, float a_max, int num_segments)
 {
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
     if (radius <= 0.0f)
     {
         _Path.push_back(center);
@@ -1173,6 +1212,7 @@ void ImDrawList::PathArcToFast(const ImVec2& center, float radius, int a_min_of_
 
 void ImDrawList::PathArcTo(const ImVec2& center, float radius, float a_min, float a_max, int num_segments)
 {
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
     if (radius <= 0.0f)
     {
         _Path.push_back(center);
@@ -1572,6 +1612,102 @@ void ImDrawList::AddBezierQuadratic(const ImVec2& p1, const ImVec2& p2, const Im
     PathStroke(col, 0, thickness);
 }
 
+// Append a shape to the current ImDrawCallback_Shapes command if nothing else was drawn since, otherwise start a new one.
+// (we check that the command owns the end of ShapeBuffer[] as commands from other channels may have added shapes in-between)
+void ImDrawList::_AddShape(ImDrawShapeType type, const ImVec2& p1, const ImVec2& p2, float rounding, float thickness, ImU32 col)
+{
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
+    ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    ImDrawCmd* prev_cmd = curr_cmd - 1;
+    if (curr_cmd->ElemCount == 0 && CmdBuffer.Size > 1 && prev_cmd->UserCallback == ImDrawCallback_Shapes && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && prev_cmd->ShapeOffset + prev_cmd->ShapeCount == (unsigned int)ShapeBuffer.Size)
+    {
+        prev_cmd->ShapeCount++;
+    }
+    else
+    {
+        AddCallback(ImDrawCallback_Shapes, NULL);
+        prev_cmd = &CmdBuffer.Data[CmdBuffer.Size - 2];
+        prev_cmd->ShapeOffset = (unsigned int)ShapeBuffer.Size;
+        prev_cmd->ShapeCount = 1;
+    }
+
+    ShapeBuffer.resize(ShapeBuffer.Size + 1);
+    ImDrawShape& shape = ShapeBuffer.back();
+    shape.P1 = p1;
+    shape.P2 = p2;
+    shape.Rounding = rounding;
+    shape.Thickness = thickness;
+    shape.Col = col;
+    shape.Type = (ImU32)type;
+}
+
+// Same coordinates conventions as AddLine(): the line is drawn between pixel centers.
+void ImDrawList::AddShapeLine(const ImVec2& p1, const ImVec2& p2, ImU32 col, float thickness)
+{
+    if (!(Flags & ImDrawListFlags_AllowShapes))
+    {
+        AddLine(p1, p2, col, thickness);
+        return;
+    }
+    if ((col & IM_COL32_A_MASK) == 0)
+        return;
+    _AddShape(ImDrawShapeType_Line, p1 + ImVec2(0.5f, 0.5f), p2 + ImVec2(0.5f, 0.5f), 0.0f, thickness, col);
+}
+
+// Same coordinates conventions as AddRect(): the outline is centered on a path inset by half a pixel.
+void ImDrawList::AddShapeRect(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, float rounding, float thickness)
+{
+    if (!(Flags & ImDrawListFlags_AllowShapes))
+    {
+        AddRect(p_min, p_max, col, rounding, 0, thickness);
+        return;
+    }
+    if ((col & IM_COL32_A_MASK) == 0 || thickness <= 0.0f)
+        return;
+    const ImVec2 a = p_min + ImVec2(0.5f, 0.5f);
+    const ImVec2 b = p_max - ImVec2(0.5f, 0.5f);
+    rounding = ImMax(ImMin(rounding, ImMin(ImFabs(b.x - a.x), ImFabs(b.y - a.y)) * 0.5f - 1.0f), 0.0f);
+    _AddShape(ImDrawShapeType_Rect, a, b, rounding, thickness, col);
+}
+
+void ImDrawList::AddShapeRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, float rounding)
+{
+    if (!(Flags & ImDrawListFlags_AllowShapes))
+    {
+        AddRectFilled(p_min, p_max, col, rounding);
+        return;
+    }
+    if ((col & IM_COL32_A_MASK) == 0)
+        return;
+    rounding = ImMax(ImMin(rounding, ImMin(ImFabs(p_max.x - p_min.x), ImFabs(p_max.y - p_min.y)) * 0.5f - 1.0f), 0.0f);
+    _AddShape(ImDrawShapeType_Rect, p_min, p_max, rounding, 0.0f, col);
+}
+
+// Same coordinates conventions as AddCircle(): the outline is centered on a circle of 'radius - 0.5f'.
+void ImDrawList::AddShapeCircle(const ImVec2& center, float radius, ImU32 col, float thickness)
+{
+    if (!(Flags & ImDrawListFlags_AllowShapes))
+    {
+        AddCircle(center, radius, col, 0, thickness);
+        return;
+    }
+    if ((col & IM_COL32_A_MASK) == 0 || radius <= 0.0f || thickness <= 0.0f)
+        return;
+    _AddShape(ImDrawShapeType_Circle, center, ImVec2(radius - 0.5f, 0.0f), 0.0f, thickness, col);
+}
+
+void ImDrawList::AddShapeCircleFilled(const ImVec2& center, float radius, ImU32 col)
+{
+    if (!(Flags & ImDrawListFlags_AllowShapes))
+    {
+        AddCircleFilled(center, radius, col);
+        return;
+    }
+    if ((col & IM_COL32_A_MASK) == 0 || radius <= 0.0f)
+        return;
+    _AddShape(ImDrawShapeType_Circle, center, ImVec2(radius, 0.0f), 0.0f, 0.0f, col);
+}
+
 void ImDrawList::AddText(const ImFont* font, float font_size, const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end, float wrap_width, const ImVec4* cpu_fine_clip_rect)
 {
     if ((col & IM_COL32_A_MASK) == 0)
@@ -1687,6 +1823,7 @@ void ImDrawListSplitter::ClearFreeMemory()
 
 void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
 {
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
     IM_UNUSED(draw_list);
     IM_ASSERT(_Current == 0 && _Count <= 1 && "Nested channel splitting is not supported. Please use separate instances of ImDrawListSplitter.");
     int old_channels_count = _Channels.Size;
@@ -1717,6 +1854,8 @@ void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
 
 void ImDrawListSplitter::Merge(ImDrawList* draw_list)
 {
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
+
     // Note that we never use or rely on _Channels.Size because it is merely a buffer that we never shrink back to 0 to keep all sub-buffers ready for use.
     if (_Count <= 1)
         return;
@@ -1817,6 +1956,7 @@ void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
 // For backward compatibility: convert all buffers from indexed to de-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
 void ImDrawData::DeIndexAllBuffers()
 {
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_DrawLists);
     ImVector<ImDrawVert> new_vtx_buffer;
     TotalVtxCount = TotalIdxCount = 0;
     for (int i = 0; i < CmdListsCount; i++)
@@ -1849,6 +1989,136 @@ void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
     }
 }
 
+// Helper to copy all vertices/indices into single destination buffers, so a renderer can issue a single upload (or none, when writing to mapped GPU memory).
+// 'vtx_dst' and 'idx_dst' need to hold TotalVtxCount and TotalIdxCount elements. ImDrawCmd::VtxOffset/IdxOffset are rebased to be offsets from the start
+// of those buffers, so the renderer needs to honor VtxOffset (see ImGuiBackendFlags_RendererHasVtxOffset) and doesn't need to add its own global offsets.
+void ImDrawData::MergeBuffers(ImDrawVert* vtx_dst, ImDrawIdx* idx_dst)
+{
+    unsigned int global_vtx_offset = 0;
+    unsigned int global_idx_offset = 0;
+    for (int i = 0; i < CmdListsCount; i++)
+    {
+        ImDrawList* cmd_list = CmdLists[i];
+        memcpy(vtx_dst + global_vtx_offset, cmd_list->VtxBuffer.Data, (size_t)cmd_list->VtxBuffer.Size * sizeof(ImDrawVert));
+        memcpy(idx_dst + global_idx_offset, cmd_list->IdxBuffer.Data, (size_t)cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx));
+
+        // Offsets may already be rebased if the same list was merged before (unsigned arithmetic wraps around as expected)
+        if (cmd_list->_MergedVtxOffset != global_vtx_offset || cmd_list->_MergedIdxOffset != global_idx_offset)
+        {
+            const unsigned int vtx_delta = global_vtx_offset - cmd_list->_MergedVtxOffset;
+            const unsigned int idx_delta = global_idx_offset - cmd_list->_MergedIdxOffset;
+            for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+            {
+                ImDrawCmd* cmd = &cmd_list->CmdBuffer[cmd_i];
+                cmd->VtxOffset += vtx_delta;
+                cmd->IdxOffset += idx_delta;
+            }
+            cmd_list->_MergedVtxOffset = global_vtx_offset;
+            cmd_list->_MergedIdxOffset = global_idx_offset;
+        }
+        global_vtx_offset += (unsigned int)cmd_list->VtxBuffer.Size;
+        global_idx_offset += (unsigned int)cmd_list->IdxBuffer.Size;
+    }
+    BuffersMerged = true;
+}
+
+// Helper to reduce the number of draw calls after MergeBuffers(), by merging consecutive commands sharing the same texture, including across lists.
+// - Commands with different clipping rectangles may be merged when clipping doesn't cut their vertices: each side of the rectangle that doesn't
+//   cut any vertex of a command can be moved further away. Sides which do cut vertices need to stay exactly the same.
+//   This is only done for pixel aligned rectangles (as most are), so the scissor rectangle computed by the renderer is exactly the clipping rectangle.
+//   Other commands are only merged when their clipping rectangles are identical.
+// - When the vertex offset differs, indices of the merged command are rewritten in 'idx_dst' (which needs to be the buffer passed to MergeBuffers()).
+//   With 16-bit indices, this is only possible as long as the rewritten indices fit.
+// - A merged command is stored in the list of its first command, other merged commands are removed. A list may end up without any command.
+void ImDrawData::MergeDrawCmds(ImDrawIdx* idx_dst)
+{
+    IM_ASSERT(BuffersMerged && "Call MergeBuffers() first!");
+    const unsigned int idx_max = (sizeof(ImDrawIdx) == 2) ? 0xFFFF : 0xFFFFFFFF;
+
+    // Allowed range for each side of the clipping rectangle of the command being extended ('run_cmd', already stored in its list)
+    ImDrawCmd* run_cmd = NULL;
+    ImVec4 run_clip_lo, run_clip_hi;
+    bool run_clip_aligned = false;
+    for (int i = 0; i < CmdListsCount; i++)
+    {
+        ImDrawList* cmd_list = CmdLists[i];
+        int write_n = 0;
+        for (int cmd_n = 0; cmd_n < cmd_list->CmdBuffer.Size; cmd_n++)
+        {
+            ImDrawCmd cmd = cmd_list->CmdBuffer[cmd_n];
+            if (cmd.UserCallback != NULL)
+            {
+                cmd_list->CmdBuffer[write_n++] = cmd;
+                run_cmd = NULL;
+                continue;
+            }
+            if (cmd.ElemCount == 0)
+                continue;
+
+            // Calculate bounds of the command from data stored in the list
+            const ImDrawIdx* src_idx = cmd_list->IdxBuffer.Data + (cmd.IdxOffset - cmd_list->_MergedIdxOffset);
+            const ImDrawVert* src_vtx = cmd_list->VtxBuffer.Data + (cmd.VtxOffset - cmd_list->_MergedVtxOffset);
+            ImRect bounds(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+            unsigned int src_idx_max = 0;
+            for (unsigned int idx_n = 0; idx_n < cmd.ElemCount; idx_n++)
+            {
+                bounds.Add(ImDrawVertGetPos(&src_vtx[src_idx[idx_n]]));
+                src_idx_max = ImMax(src_idx_max, (unsigned int)src_idx[idx_n]);
+            }
+
+            // Calculate allowed range for each side of the clipping rectangle
+            const ImVec4& clip = cmd.ClipRect;
+            const bool clip_aligned = (clip.x == ImFloor(clip.x) && clip.y == ImFloor(clip.y) && clip.z == ImFloor(clip.z) && clip.w == ImFloor(clip.w));
+            ImVec4 clip_lo = clip, clip_hi = clip;
+            if (clip_aligned)
+            {
+                if (bounds.Min.x >= clip.x) { clip_lo.x = -FLT_MAX; clip_hi.x = bounds.Min.x; }
+                if (bounds.Min.y >= clip.y) { clip_lo.y = -FLT_MAX; clip_hi.y = bounds.Min.y; }
+                if (bounds.Max.x <= clip.z) { clip_lo.z = bounds.Max.x; clip_hi.z = +FLT_MAX; }
+                if (bounds.Max.y <= clip.w) { clip_lo.w = bounds.Max.y; clip_hi.w = +FLT_MAX; }
+            }
+
+            // Try to append to current run
+            bool merge = (run_cmd != NULL && run_cmd->TextureId == cmd.TextureId && run_cmd->IdxOffset + run_cmd->ElemCount == cmd.IdxOffset);
+            const unsigned int vtx_delta = merge ? cmd.VtxOffset - run_cmd->VtxOffset : 0;
+            if (merge && vtx_delta != 0 && src_idx_max > idx_max - vtx_delta)
+                merge = false;
+            if (merge && (!clip_aligned || !run_clip_aligned))
+                merge = (memcmp(&run_cmd->ClipRect, &clip, sizeof(ImVec4)) == 0 && memcmp(&run_clip_lo, &run_clip_hi, sizeof(ImVec4)) == 0 && memcmp(&clip_lo, &clip_hi, sizeof(ImVec4)) == 0);
+            if (merge)
+            {
+                clip_lo = ImVec4(ImMax(run_clip_lo.x, clip_lo.x), ImMax(run_clip_lo.y, clip_lo.y), ImMax(run_clip_lo.z, clip_lo.z), ImMax(run_clip_lo.w, clip_lo.w));
+                clip_hi = ImVec4(ImMin(run_clip_hi.x, clip_hi.x), ImMin(run_clip_hi.y, clip_hi.y), ImMin(run_clip_hi.z, clip_hi.z), ImMin(run_clip_hi.w, clip_hi.w));
+                merge = (clip_lo.x <= clip_hi.x && clip_lo.y <= clip_hi.y && clip_lo.z <= clip_hi.z && clip_lo.w <= clip_hi.w);
+            }
+            if (merge)
+            {
+                if (vtx_delta != 0)
+                    for (unsigned int idx_n = 0; idx_n < cmd.ElemCount; idx_n++)
+                        idx_dst[cmd.IdxOffset + idx_n] = (ImDrawIdx)(src_idx[idx_n] + vtx_delta);
+                run_cmd->ElemCount += cmd.ElemCount;
+                run_clip_lo = clip_lo;
+                run_clip_hi = clip_hi;
+
+                // Fixed sides are pixel aligned, otherwise use the tightest pixel aligned value
+                run_cmd->ClipRect.x = (clip_lo.x == clip_hi.x) ? clip_lo.x : ImFloor(clip_hi.x);
+                run_cmd->ClipRect.y = (clip_lo.y == clip_hi.y) ? clip_lo.y : ImFloor(clip_hi.y);
+                run_cmd->ClipRect.z = (clip_lo.z == clip_hi.z) ? clip_lo.z : ImCeil(clip_lo.z);
+                run_cmd->ClipRect.w = (clip_lo.w == clip_hi.w) ? clip_lo.w : ImCeil(clip_lo.w);
+                continue;
+            }
+
+            // Start a new run
+            cmd_list->CmdBuffer[write_n] = cmd;
+            run_cmd = &cmd_list->CmdBuffer[write_n++];
+            run_clip_lo = clip_lo;
+            run_clip_hi = clip_hi;
+            run_clip_aligned = clip_aligned;
+        }
+        cmd_list->CmdBuffer.resize(write_n); // Shrinking doesn't reallocate, so 'run_cmd' stays valid
+    }
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Helpers ShadeVertsXXX functions
 //-----------------------------------------------------------------------------
@@ -1868,7 +2138,7 @@ void ImGui::ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int ve
     const int col_delta_b = ((int)(col1 >> IM_COL32_B_SHIFT) & 0xFF) - col0_b;
     for (ImDrawVert* vert = vert_start; vert < vert_end; vert++)
     {
-        float d = ImDot(vert->pos - gradient_p0, gradient_extent);
+        float d = ImDot(ImDrawVertGetPos(vert) - gradient_p0, gradient_extent);
         float t = ImClamp(d * gradient_inv_length2, 0.0f, 1.0f);
         int r = (int)(col0_r + col_delta_r * t);
         int g = (int)(col0_g + col_delta_g * t);
@@ -1893,12 +2163,12 @@ void ImGui::ShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int ve
         const ImVec2 min = ImMin(uv_a, uv_b);
         const ImVec2 max = ImMax(uv_a, uv_b);
         for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-            vertex->uv = ImClamp(uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale), min, max);
+            ImDrawVertSetUV(vertex, ImClamp(uv_a + ImMul(ImDrawVertGetPos(vertex) - a, scale), min, max));
     }
     else
     {
         for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
-            vertex->uv = uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale);
+            ImDrawVertSetUV(vertex, uv_a + ImMul(ImDrawVertGetPos(vertex) - a, scale));
     }
 }
 
@@ -2031,6 +2301,8 @@ void    ImFontAtlas::Clear()
 
 void    ImFontAtlas::GetTexDataAsAlpha8(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel)
 {
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_Fonts);
+
     // Build atlas on demand
     if (TexPixelsAlpha8 == NULL)
     {
@@ -2047,6 +2319,8 @@ void    ImFontAtlas::GetTexDataAsAlpha8(unsigned char** out_pixels, int* out_wid
 
 void    ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel)
 {
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_Fonts);
+
     // Convert to RGBA32 format on demand
     // Although it is likely to be the most commonly used format, our font rendering is 1 channel / 8 bpp
     if (!TexPixelsRGBA32)
@@ -2071,6 +2345,7 @@ void    ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_wid
 
 ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
 {
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_Fonts);
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
     IM_ASSERT(font_cfg->FontData != NULL && font_cfg->FontDataSize > 0);
     IM_ASSERT(font_cfg->SizePixels > 0.0f);
@@ -2140,6 +2415,7 @@ ImFont* ImFontAtlas::AddFontDefault(const ImFontConfig* font_cfg_template)
 
 ImFont* ImFontAtlas::AddFontFromFileTTF(const char* filename, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
 {
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_Fonts);
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
     size_t data_size = 0;
     void* data = ImFileLoadToMemory(filename, "rb", &data_size, 0);
@@ -2175,6 +2451,7 @@ ImFont* ImFontAtlas::AddFontFromMemoryTTF(void* ttf_data, int ttf_size, float si
 
 ImFont* ImFontAtlas::AddFontFromMemoryCompressedTTF(const void* compressed_ttf_data, int compressed_ttf_size, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
 {
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_Fonts);
     const unsigned int buf_decompressed_size = stb_decompress_length((const unsigned char*)compressed_ttf_data);
     unsigned char* buf_decompressed_data = (unsigned char*)IM_ALLOC(buf_decompressed_size);
     stb_decompress(buf_decompressed_data, (const unsigned char*)compressed_ttf_data, (unsigned int)compressed_ttf_size);
@@ -2197,6 +2474,7 @@ ImFont* ImFontAtlas::AddFontFromMemoryCompressedBase85TTF(const char* compressed
 
 int ImFontAtlas::AddCustomRectRegular(int width, int height)
 {
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_Fonts);
     IM_ASSERT(width > 0 && width <= 0xFFFF);
     IM_ASSERT(height > 0 && height <= 0xFFFF);
     ImFontAtlasCustomRect r;
@@ -2208,6 +2486,8 @@ int ImFontAtlas::AddCustomRectRegular(int width, int height)
 
 int ImFontAtlas::AddCustomRectFontGlyph(ImFont* font, ImWchar id, int width, int height, float advance_x, const ImVec2& offset)
 {
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_Fonts);
+
 #ifdef IMGUI_USE_WCHAR32
     IM_ASSERT(id <= IM_UNICODE_CODEPOINT_MAX);
 #endif
@@ -2256,6 +2536,7 @@ bool ImFontAtlas::GetMouseCursorTexData(ImGuiMouseCursor cursor_type, ImVec2* ou
 
 bool    ImFontAtlas::Build()
 {
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_Fonts);
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
 
     // Select builder
@@ -2588,8 +2869,7 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 
 const ImFontBuilderIO* ImFontAtlasGetBuilderForStbTruetype()
 {
-    static ImFontBuilderIO io;
-    io.FontBuilder_Build = ImFontAtlasBuildWithStbTruetype;
+    static const ImFontBuilderIO io = { ImFontAtlasBuildWithStbTruetype };
     return &io;
 }
 
@@ -2901,7 +3181,7 @@ const ImWchar*  ImFontAtlas::GetGlyphRangesChineseSimplifiedCommon()
         2,2,7,34,21,13,70,2,128,1,1,2,1,1,2,1,1,3,2,2,2,15,1,4,1,3,4,42,10,6,1,49,85,8,1,2,1,1,4,4,2,3,6,1,5,7,4,3,211,4,1,2,1,2,5,1,2,4,2,2,6,5,6,
         10,3,4,48,100,6,2,16,296,5,27,387,2,2,3,7,16,8,5,38,15,39,21,9,10,3,7,59,13,27,21,47,5,21,6
     };
-    static ImWchar base_ranges[] = // not zero-terminated
+    static const ImWchar base_ranges[] = // not zero-terminated
     {
         0x0020, 0x00FF, // Basic Latin + Latin Supplement
         0x2000, 0x206F, // General Punctuation
@@ -2910,13 +3190,15 @@ const ImWchar*  ImFontAtlas::GetGlyphRangesChineseSimplifiedCommon()
         0xFF00, 0xFFEF, // Half-width characters
         0xFFFD, 0xFFFD  // Invalid
     };
-    static ImWchar full_ranges[IM_ARRAYSIZE(base_ranges) + IM_ARRAYSIZE(accumulative_offsets_from_0x4E00) * 2 + 1] = { 0 };
-    if (!full_ranges[0])
+    // Unpack into storage owned by the atlas rather than a function-local static buffer, which would race when called from multiple threads
+    ImVector<ImWchar>& full_ranges = GlyphRangesChineseSimplifiedCommonData;
+    if (full_ranges.empty())
     {
-        memcpy(full_ranges, base_ranges, sizeof(base_ranges));
-        UnpackAccumulativeOffsetsIntoRanges(0x4E00, accumulative_offsets_from_0x4E00, IM_ARRAYSIZE(accumulative_offsets_from_0x4E00), full_ranges + IM_ARRAYSIZE(base_ranges));
+        full_ranges.resize(IM_ARRAYSIZE(base_ranges) + IM_ARRAYSIZE(accumulative_offsets_from_0x4E00) * 2 + 1);
+        memcpy(full_ranges.Data, base_ranges, sizeof(base_ranges));
+        UnpackAccumulativeOffsetsIntoRanges(0x4E00, accumulative_offsets_from_0x4E00, IM_ARRAYSIZE(accumulative_offsets_from_0x4E00), full_ranges.Data + IM_ARRAYSIZE(base_ranges));
     }
-    return &full_ranges[0];
+    return full_ranges.Data;
 }
 
 const ImWchar*  ImFontAtlas::GetGlyphRangesJapanese()
@@ -2992,7 +3274,7 @@ const ImWchar*  ImFontAtlas::GetGlyphRangesJapanese()
         4,1,10,3,1,6,1,2,51,5,40,15,24,43,22928,11,1,13,154,70,3,1,1,7,4,10,1,2,1,1,2,1,2,1,2,2,1,1,2,1,1,1,1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1,2,1,1,1,
         3,2,1,1,1,1,2,1,1,
     };
-    static ImWchar base_ranges[] = // not zero-terminated
+    static const ImWchar base_ranges[] = // not zero-terminated
     {
         0x0020, 0x00FF, // Basic Latin + Latin Supplement
         0x3000, 0x30FF, // CJK Symbols and Punctuations, Hiragana, Katakana
@@ -3000,13 +3282,14 @@ const ImWchar*  ImFontAtlas::GetGlyphRangesJapanese()
         0xFF00, 0xFFEF, // Half-width characters
         0xFFFD, 0xFFFD  // Invalid
     };
-    static ImWchar full_ranges[IM_ARRAYSIZE(base_ranges) + IM_ARRAYSIZE(accumulative_offsets_from_0x4E00)*2 + 1] = { 0 };
-    if (!full_ranges[0])
+    ImVector<ImWchar>& full_ranges = GlyphRangesJapaneseData; // See GetGlyphRangesChineseSimplifiedCommon()
+    if (full_ranges.empty())
     {
-        memcpy(full_ranges, base_ranges, sizeof(base_ranges));
-        UnpackAccumulativeOffsetsIntoRanges(0x4E00, accumulative_offsets_from_0x4E00, IM_ARRAYSIZE(accumulative_offsets_from_0x4E00), full_ranges + IM_ARRAYSIZE(base_ranges));
+        full_ranges.resize(IM_ARRAYSIZE(base_ranges) + IM_ARRAYSIZE(accumulative_offsets_from_0x4E00) * 2 + 1);
+        memcpy(full_ranges.Data, base_ranges, sizeof(base_ranges));
+        UnpackAccumulativeOffsetsIntoRanges(0x4E00, accumulative_offsets_from_0x4E00, IM_ARRAYSIZE(accumulative_offsets_from_0x4E00), full_ranges.Data + IM_ARRAYSIZE(base_ranges));
     }
-    return &full_ranges[0];
+    return full_ranges.Data;
 }
 
 const ImWchar*  ImFontAtlas::GetGlyphRangesCyrillic()
@@ -3140,6 +3423,7 @@ static ImWchar FindFirstExistingGlyph(ImFont* font, const ImWchar* candidate_cha
 
 void ImFont::BuildLookupTable()
 {
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_Fonts);
     int max_codepoint = 0;
     for (int i = 0; i != Glyphs.Size; i++)
         max_codepoint = ImMax(max_codepoint, (int)Glyphs[i].Codepoint);
@@ -3231,6 +3515,7 @@ void ImFont::SetGlyphVisible(ImWchar c, bool visible)
 
 void ImFont::GrowIndex(int new_size)
 {
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_Fonts);
     IM_ASSERT(IndexAdvanceX.Size == IndexLookup.Size);
     if (new_size <= IndexLookup.Size)
         return;
@@ -3243,6 +3528,7 @@ void ImFont::GrowIndex(int new_size)
 // 'cfg' is not necessarily == 'this->ConfigData' because multiple source fonts+configs can be used to build one target font.
 void ImFont::AddGlyph(const ImFontConfig* cfg, ImWchar codepoint, float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, float advance_x)
 {
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_Fonts);
     if (cfg != NULL)
     {
         // Clamp & recenter if needed
@@ -3287,6 +3573,7 @@ void ImFont::AddGlyph(const ImFontConfig* cfg, ImWchar codepoint, float x0, floa
 
 void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
 {
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_Fonts);
     IM_ASSERT(IndexLookup.Size > 0);    // Currently this can only be called AFTER the font has been built, aka after calling ImFontAtlas::GetTexDataAs*() function.
     unsigned int index_size = (unsigned int)IndexLookup.Size;
 
@@ -3698,10 +3985,10 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
                 {
                     idx_write[0] = (ImDrawIdx)(vtx_current_idx); idx_write[1] = (ImDrawIdx)(vtx_current_idx+1); idx_write[2] = (ImDrawIdx)(vtx_current_idx+2);
                     idx_write[3] = (ImDrawIdx)(vtx_current_idx); idx_write[4] = (ImDrawIdx)(vtx_current_idx+2); idx_write[5] = (ImDrawIdx)(vtx_current_idx+3);
-                    vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
-                    vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
-                    vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = glyph_col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
-                    vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = glyph_col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
+                    ImDrawVertSetPos(&vtx_write[0], x1, y1); vtx_write[0].col = glyph_col; ImDrawVertSetUV(&vtx_write[0], u1, v1);
+                    ImDrawVertSetPos(&vtx_write[1], x2, y1); vtx_write[1].col = glyph_col; ImDrawVertSetUV(&vtx_write[1], u2, v1);
+                    ImDrawVertSetPos(&vtx_write[2], x2, y2); vtx_write[2].col = glyph_col; ImDrawVertSetUV(&vtx_write[2], u2, v2);
+                    ImDrawVertSetPos(&vtx_write[3], x1, y2); vtx_write[3].col = glyph_col; ImDrawVertSetUV(&vtx_write[3], u1, v2);
                     vtx_write += 4;
                     vtx_current_idx += 4;
                     idx_write += 6;
@@ -3961,9 +4248,10 @@ static unsigned int stb_decompress_length(const unsigned char *input)
     return (input[8] << 24) + (input[9] << 16) + (input[10] << 8) + input[11];
 }
 
-static unsigned char *stb__barrier_out_e, *stb__barrier_out_b;
-static const unsigned char *stb__barrier_in_b;
-static unsigned char *stb__dout;
+// (decompression state is thread-local with IMGUI_USE_THREAD_LOCAL_CONTEXT, so atlases of different contexts may be built concurrently)
+static IM_THREAD_LOCAL unsigned char *stb__barrier_out_e, *stb__barrier_out_b;
+static IM_THREAD_LOCAL const unsigned char *stb__barrier_in_b;
+static IM_THREAD_LOCAL unsigned char *stb__dout;
 static void stb__match(const unsigned char *data, unsigned int length)
 {
     // INVERSE of memmove... write each byte before copying the next...
@@ -32,6 +32,8 @@ Index of this file:
 // [SECTION] ImGui internal API
 // [SECTION] ImFontAtlas internal API
 // [SECTION] Test Engine specific hooks (imgui_test_engine)
+// [SECTION] Frame profiler (IMGUI_ENABLE_PROFILER)
+// [SECTION] Memory tags (IMGUI_ENABLE_MEMORY_TAGS)
 
 */
 
@@ -55,6 +57,9 @@ Index of this file:
 #if (defined __SSE__ || defined __x86_64__ || defined _M_X64) && !defined(IMGUI_DISABLE_SSE)
 #define IMGUI_ENABLE_SSE
 #include <immintrin.h>
+#if (defined __SSE2__ || defined __x86_64__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2))
+#define IMGUI_ENABLE_SSE2
+#endif
 #endif
 
 // Visual Studio warnings
@@ -110,11 +115,14 @@ struct ImBitVector;                 // Store 1-bit per value
 struct ImRect;                      // An axis-aligned rectangle (2 points)
 struct ImDrawDataBuilder;           // Helper to build a ImDrawData instance
 struct ImDrawListSharedData;        // Data shared between all ImDrawList instances
+struct ImGuiCachedRegion;           // Storage for BeginCachedRegion()/EndCachedRegion()
 struct ImGuiColorMod;               // Stacked color modifier, backup of modified data so we can restore it
 struct ImGuiContext;                // Main Dear ImGui context
 struct ImGuiContextHook;            // Hook for extensions like ImGuiTestEngine
 struct ImGuiDataTypeInfo;           // Type information associated to a ImGuiDataType enum
+struct ImGuiDataTypeFormat;         // Parsed format string, cached for RoundScalarWithFormatT()
 struct ImGuiGroupData;              // Stacked storage data for BeginGroup()/EndGroup()
+struct ImGuiInputEvent;             // Input event queued by io.AddXXXEvent() functions, applied by NewFrame()
 struct ImGuiInputTextState;         // Internal state of the currently focused/edited text input box
 struct ImGuiLastItemDataBackup;     // Backup and restore IsItemHovered() internal data
 struct ImGuiMenuColumns;            // Simple column measurement, currently used for MenuItem() only
@@ -124,7 +132,11 @@ struct ImGuiNextWindowData;         // Storage for SetNextWindow** functions
 struct ImGuiNextItemData;           // Storage for SetNextItem** functions
 struct ImGuiOldColumnData;          // Storage data for a single column for legacy Columns() api
 struct ImGuiOldColumns;             // Storage data for a columns set for legacy Columns() api
+struct ImGuiPlotLod;                // Storage for the min/max level-of-detail of a PlotLines()/PlotHistogram() with many values
+struct ImGuiPlotStreamState;        // Storage for a PlotLines()/PlotHistogram() of a ImGuiPlotStream
 struct ImGuiPopupData;              // Storage for current popup stack
+struct ImGuiMemTagStats;            // Memory accounting for one subsystem (when IMGUI_ENABLE_MEMORY_TAGS is defined)
+struct ImGuiProfiler;               // Storage for the frame profiler (when IMGUI_ENABLE_PROFILER is defined)
 struct ImGuiSettingsHandler;        // Storage for one type registered in the .ini file
 struct ImGuiStackSizes;             // Storage of stack sizes for debugging/asserting
 struct ImGuiStyleMod;               // Stacked style modifier, backup of modified data so we can restore it
@@ -136,11 +148,13 @@ struct ImGuiTableTempData;          // Temporary storage for one table (one per
 struct ImGuiTableSettings;          // Storage for a table .ini settings
 struct ImGuiTableColumnsSettings;   // Storage for a column .ini settings
 struct ImGuiWindow;                 // Storage for one window
+struct ImGuiWindowHoverGrid;        // Spatial index of hoverable windows for FindHoveredWindow()
 struct ImGuiWindowTempData;         // Temporary storage for one window (that's the data which in theory we could ditch at the end of the frame, in practice we currently keep it for each window)
 struct ImGuiWindowSettings;         // Storage for a window .ini settings (we keep one of those even if the actual window wasn't instanced during this session)
 
 // Use your programming IDE "Go to definition" facility on the names of the center columns to find the actual flags/enum lists.
 typedef int ImGuiLayoutType;            // -> enum ImGuiLayoutType_         // Enum: Horizontal or vertical
+typedef int ImGuiMemTag;                // -> enum ImGuiMemTag_             // Enum: Subsystem owning an allocation (when IMGUI_ENABLE_MEMORY_TAGS is defined)
 typedef int ImGuiItemFlags;             // -> enum ImGuiItemFlags_          // Flags: for PushItemFlag()
 typedef int ImGuiItemAddFlags;          // -> enum ImGuiItemAddFlags_       // Flags: for ItemAdd()
 typedef int ImGuiItemStatusFlags;       // -> enum ImGuiItemStatusFlags_    // Flags: for DC.LastItemStatusFlags
@@ -161,8 +175,20 @@ typedef void (*ImGuiErrorLogCallback)(void* user_data, const char* fmt, ...);
 // See implementation of this variable in imgui.cpp for comments and details.
 //-----------------------------------------------------------------------------
 
+#ifdef IMGUI_USE_THREAD_LOCAL_CONTEXT
+#if __cplusplus >= 201103L || (defined(_MSC_VER) && _MSC_VER >= 1900)
+#define IM_THREAD_LOCAL                 thread_local
+#elif defined(_MSC_VER)
+#define IM_THREAD_LOCAL                 __declspec(thread)
+#else
+#define IM_THREAD_LOCAL                 __thread
+#endif
+#else
+#define IM_THREAD_LOCAL
+#endif
+
 #ifndef GImGui
-extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
+extern IMGUI_API IM_THREAD_LOCAL ImGuiContext* GImGui;  // Current implicit context pointer (per thread when IMGUI_USE_THREAD_LOCAL_CONTEXT is defined)
 #endif
 
 //-------------------------------------------------------------------------
@@ -316,6 +342,7 @@ IMGUI_API void          ImStrTrimBlanks(char* str);
 IMGUI_API const char*   ImStrSkipBlank(const char* str);
 IMGUI_API int           ImFormatString(char* buf, size_t buf_size, const char* fmt, ...) IM_FMTARGS(3);
 IMGUI_API int           ImFormatStringV(char* buf, size_t buf_size, const char* fmt, va_list args) IM_FMTLIST(3);
+IMGUI_API bool          ImFormatRoundDouble(double v, int precision, double* out);      // Same as ImAtof() of ImFormatString("%.<precision>f", v). Return false if unsupported. Not available with IMGUI_DISABLE_DEFAULT_FORMAT_FUNCTIONS.
 IMGUI_API const char*   ImParseFormatFindStart(const char* format);
 IMGUI_API const char*   ImParseFormatFindEnd(const char* format);
 IMGUI_API const char*   ImParseFormatTrimDecorations(const char* format, char* buf, size_t buf_size);
@@ -372,6 +399,7 @@ IMGUI_API bool              ImFileClose(ImFileHandle file);
 IMGUI_API ImU64             ImFileGetSize(ImFileHandle file);
 IMGUI_API ImU64             ImFileRead(void* data, ImU64 size, ImU64 count, ImFileHandle file);
 IMGUI_API ImU64             ImFileWrite(const void* data, ImU64 size, ImU64 count, ImFileHandle file);
+IMGUI_API bool              ImFileRename(const char* src_filename, const char* dst_filename);
 #else
 #define IMGUI_DISABLE_TTY_FUNCTIONS // Can't use stdout, fflush if we are not using default file functions
 #endif
@@ -875,7 +903,8 @@ enum ImGuiLogType
     ImGuiLogType_TTY,
     ImGuiLogType_File,
     ImGuiLogType_Buffer,
-    ImGuiLogType_Clipboard
+    ImGuiLogType_Clipboard,
+    ImGuiLogType_Callback
 };
 
 // X/Y enums are fixed to 0/1 so they may be used to index ImVec2
@@ -914,6 +943,43 @@ enum ImGuiInputReadMode
     ImGuiInputReadMode_RepeatFast
 };
 
+// Type of an input event queued by io.AddXXXEvent() functions
+enum ImGuiInputEventType
+{
+    ImGuiInputEventType_None = 0,
+    ImGuiInputEventType_MousePos,
+    ImGuiInputEventType_MouseButton,
+    ImGuiInputEventType_MouseWheel,
+    ImGuiInputEventType_Key,
+    ImGuiInputEventType_KeyMods,
+    ImGuiInputEventType_Char,
+    ImGuiInputEventType_COUNT
+};
+
+struct ImGuiInputEventMousePos      { float PosX, PosY; };
+struct ImGuiInputEventMouseButton   { int Button; bool Down; };
+struct ImGuiInputEventMouseWheel    { float WheelX, WheelY; };
+struct ImGuiInputEventKey           { int Key; bool Down; };
+struct ImGuiInputEventKeyMods       { ImGuiKeyModFlags Mods; };
+struct ImGuiInputEventChar          { unsigned int Char; };
+
+// Stored in g.InputEventsQueue, in submission order
+struct ImGuiInputEvent
+{
+    ImGuiInputEventType         Type;
+    union
+    {
+        ImGuiInputEventMousePos     MousePos;       // if Type == ImGuiInputEventType_MousePos
+        ImGuiInputEventMouseButton  MouseButton;    // if Type == ImGuiInputEventType_MouseButton
+        ImGuiInputEventMouseWheel   MouseWheel;     // if Type == ImGuiInputEventType_MouseWheel
+        ImGuiInputEventKey          Key;            // if Type == ImGuiInputEventType_Key
+        ImGuiInputEventKeyMods      KeyMods;        // if Type == ImGuiInputEventType_KeyMods
+        ImGuiInputEventChar         Char;           // if Type == ImGuiInputEventType_Char
+    };
+
+    ImGuiInputEvent() { memset(this, 0, sizeof(*this)); }
+};
+
 enum ImGuiNavHighlightFlags_
 {
     ImGuiNavHighlightFlags_None         = 0,
@@ -978,6 +1044,18 @@ struct ImGuiDataTypeInfo
     const char* ScanFmt;        // Default scanf format for the type
 };
 
+// Format string parsed by RoundScalarWithFormatT(), cached in ImGuiContext::DataTypeFormatCache[] keyed by the format string pointer.
+struct ImGuiDataTypeFormat
+{
+    const char* Format;             // Format string pointer (key)
+    char        FormatCopy[24];     // Copy of the format string up to the end of the specifier, in case the same buffer is reused with different contents
+    char        Conversion;         // Conversion character ('d', 'f', etc.), 0 if the value is not displayed, '?' if we don't know how to parse the specifier
+    ImS8        Precision;          // -1 if not specified
+    ImS8        ArgSize;            // Size of the argument read by the specifier, following length modifiers (e.g. "%lld" -> 8), 0 if it truncates (e.g. "%hd")
+
+    ImGuiDataTypeFormat() { memset(this, 0, sizeof(*this)); }
+};
+
 // Extend ImGuiDataType_
 enum ImGuiDataTypePrivate_
 {
@@ -1032,6 +1110,108 @@ struct IMGUI_API ImGuiGroupData
     bool        EmitItem;
 };
 
+// Range of indices recorded by a cached region, sharing the same clipping rectangle and texture
+struct ImGuiCachedRegionCmd
+{
+    ImVec4          ClipRect;
+    ImTextureID     TextureId;
+    unsigned int    ElemCount;
+};
+
+// Storage for BeginCachedRegion()/EndCachedRegion()
+// The recorded output is only replayed at the same position with the same clipping rectangle, style and font as when it was recorded.
+struct IMGUI_API ImGuiCachedRegion
+{
+    ImGuiID         ID;
+    ImGuiID         WindowID;
+    ImU32           Version;                // User-provided version key of the recorded contents
+    ImU32           StyleHash;              // Hash of the whole ImGuiStyle structure at the time of recording
+    ImFont*         Font;
+    float           FontSize;
+    ImGuiItemFlags  ItemFlags;
+    ImDrawListFlags DrawListFlags;
+    float           ItemWidth;              // window->DC.ItemWidth
+    float           TextWrapPos;            // window->DC.TextWrapPos
+    ImVec2          StartPos;               // Absolute position of the region (cursor position in BeginCachedRegion())
+    ImVec2          Size;                   // Size of the region, as it will be captured by EndGroup()
+    ImVec2          IdealMaxPos;            // Contribution of the contents to window->DC.IdealMaxPos
+    ImRect          ClipRect;               // window->ClipRect
+    ImVec4          DrawListClipRect;       // Clipping rectangle and texture of the draw list at the time of recording
+    ImTextureID     DrawListTextureId;
+    float           PrevLineTextBaseOffset;
+    int             FocusCounterRegular;    // Number of items registered with the legacy focus system by the contents
+    int             FocusCounterTabStop;
+    short           NavLayersActiveMask;
+    ImGuiNavLayer   NavLayer;               // Navigation data of g.NavId when it was submitted by the contents (only recorded with navigation highlight disabled)
+    ImGuiID         NavId;
+    ImGuiID         NavFocusScopeId;
+    ImRect          NavRectRel;
+    int             LastFrameActive;
+    float           LastTimeActive;
+    bool            IsValid;                // Recorded output can be replayed
+    bool            IsReplaying;            // Contents are not submitted this frame
+    ImVector<ImDrawVert>            VtxBuffer;
+    ImVector<ImDrawIdx>             IdxBuffer;  // Indices relative to the first recorded vertex
+    ImVector<ImGuiCachedRegionCmd>  CmdBuffer;
+
+    // Backup of state at the beginning of a recording
+    int             BackupVtxBufferSize;
+    int             BackupIdxBufferSize;
+    unsigned int    BackupVtxOffset;
+    int             BackupChannel;
+    int             BackupWindowsActiveCount;
+    int             BackupTablesBeginCount;
+    int             BackupColumnsBeginCount;
+    ImGuiTable*     BackupCurrentTable;     // Contents may not change the current table, nor its current cell
+    int             BackupTableCurrentRow;
+    int             BackupTableCurrentColumn;
+    ImGuiOldColumns* BackupCurrentColumns;  // Same for legacy columns
+    int             BackupColumnsCurrent;
+    int             BackupFocusCounterRegular;
+    int             BackupFocusCounterTabStop;
+    short           BackupNavLayersActiveMask;
+    bool            BackupNavIdIsAlive;
+    ImVec2          BackupIdealMaxPos;
+
+    ImGuiCachedRegion() { memset(this, 0, sizeof(*this)); LastFrameActive = -1; LastTimeActive = -1.0f; }
+};
+
+// Storage for the min/max level-of-detail of a PlotLines()/PlotHistogram() with many more values than pixels
+// Nodes[] stores a pyramid of (min, max) pairs: the first level reduces blocks of consecutive values (in storage order, before
+// 'values_offset' is applied) and each following level reduces two nodes of the previous one, until there is a single node.
+struct IMGUI_API ImGuiPlotLod
+{
+    ImGuiID         ID;
+    float           (*ValuesGetter)(void* data, int idx);
+    const void*     DataSource;             // Values pointer (arrays) or user data (getters) the nodes were built from
+    int             DataStride;             // Stride of arrays, 0 for getters
+    int             ValuesCount;
+    ImU32           DataVersion;            // Set by SetNextPlotDataVersion(), nodes are only reused if it didn't change
+    bool            HasDataVersion;
+    float           LastTimeActive;
+    ImVector<ImVec2>    Nodes;              // (min, max) pairs, NaN values are ignored. FLT_MAX/-FLT_MAX if all values are NaN.
+    ImVector<int>       LevelOffsets;       // Index of the first node of each level in Nodes[]
+
+    ImGuiPlotLod()  { ID = 0; ValuesGetter = NULL; DataSource = NULL; DataStride = ValuesCount = 0; DataVersion = 0; HasDataVersion = false; LastTimeActive = -1.0f; }
+};
+
+// Storage for a PlotLines()/PlotHistogram() of a ImGuiPlotStream
+// Values are reduced in columns of ValuesPerColumn values, aligned on multiples of ValuesPerColumn since the first value ever pushed,
+// so the (min, max) of a full column never changes: it is computed once and scrolls along with the plot.
+struct IMGUI_API ImGuiPlotStreamState
+{
+    ImGuiID                 ID;
+    const ImGuiPlotStream*  Stream;
+    int                     Capacity;
+    int                     ValuesPerColumn;
+    ImU64                   ColumnsEnd;     // Index of the first column not computed yet (columns before it are all full)
+    float                   LastTimeActive;
+    ImVector<ImVec2>        Columns;        // (min, max) of full columns, indexed by column index % Columns.Size
+    ImVector<ImVec2>        VisibleColumns; // (min, max) of columns displayed this frame
+
+    ImGuiPlotStreamState()  { ID = 0; Stream = NULL; Capacity = ValuesPerColumn = 0; ColumnsEnd = 0; LastTimeActive = -1.0f; }
+};
+
 // Simple column measurement, currently used for MenuItem() only.. This is very short-sighted/throw-away code and NOT a generic helper.
 struct IMGUI_API ImGuiMenuColumns
 {
@@ -1147,9 +1327,10 @@ struct ImGuiNextWindowData
 
 enum ImGuiNextItemDataFlags_
 {
-    ImGuiNextItemDataFlags_None     = 0,
-    ImGuiNextItemDataFlags_HasWidth = 1 << 0,
-    ImGuiNextItemDataFlags_HasOpen  = 1 << 1
+    ImGuiNextItemDataFlags_None                 = 0,
+    ImGuiNextItemDataFlags_HasWidth             = 1 << 0,
+    ImGuiNextItemDataFlags_HasOpen              = 1 << 1,
+    ImGuiNextItemDataFlags_HasPlotDataVersion   = 1 << 2
 };
 
 struct ImGuiNextItemData
@@ -1159,6 +1340,7 @@ struct ImGuiNextItemData
     ImGuiID                     FocusScopeId;   // Set by SetNextItemMultiSelectData() (!= 0 signify value has been set, so it's an alternate version of HasSelectionData, we don't use Flags for this because they are cleared too early. This is mostly used for debugging)
     ImGuiCond                   OpenCond;
     bool                        OpenVal;        // Set by SetNextItemOpen()
+    ImU32                       PlotDataVersion; // Set by SetNextPlotDataVersion()
 
     ImGuiNextItemData()         { memset(this, 0, sizeof(*this)); }
     inline void ClearFlags()    { Flags = ImGuiNextItemDataFlags_None; } // Also cleared manually by ItemAdd()!
@@ -1170,6 +1352,26 @@ struct ImGuiShrinkWidthItem
     float       Width;
 };
 
+// Storage for FindHoveredWindow(): hit-test rectangles of hoverable windows bucketed into a uniform grid, so only windows overlapping the mouse cell are tested.
+// Built by EndFrame() from the sorted window list and used by the following NewFrame(). Changing the display order in between invalidates it.
+struct ImGuiWindowHoverGrid
+{
+    ImVector<ImGuiWindow*>  Windows;            // Hoverable windows, back to front
+    ImVector<ImRect>        Rects;              // Hit-test rectangle of each window (OuterRectClipped + padding)
+    ImVector<int>           CellStart;          // Indices of windows overlapping cell n are stored in CellWindows[CellStart[n]] to CellWindows[CellStart[n + 1] - 1], back to front
+    ImVector<int>           CellWindows;
+    ImRect                  Bounds;
+    ImVec2                  CellScale;          // Number of cells per pixel
+    int                     CellsX, CellsY;
+    ImVec2                  PaddingRegular;     // Padding applied to Rects[], grid is not used if the padding we want is different
+    ImVec2                  PaddingForResize;
+    bool                    Valid;
+
+    ImGuiWindowHoverGrid()  { CellsX = CellsY = 0; Valid = false; }
+    int     GetCellX(float x) const { return ImClamp((int)((x - Bounds.Min.x) * CellScale.x), 0, CellsX - 1); }
+    int     GetCellY(float y) const { return ImClamp((int)((y - Bounds.Min.y) * CellScale.y), 0, CellsY - 1); }
+};
+
 struct ImGuiPtrOrIndex
 {
     void*       Ptr;            // Either field can be set, not both. e.g. Dock node tab bars are loose while BeginTabBar() ones are in a pool.
@@ -1297,6 +1499,9 @@ struct ImGuiWindowSettings
     ImVec2ih    Size;
     bool        Collapsed;
     bool        WantApply;      // Set when loaded from .ini data (to enable merging/loading .ini data into an already running context)
+    bool        WantSaveBinary; // Modified since last written to the binary .ini journal (io.IniSavingBinary)
+    int         WriteCacheOffset; // Output of last save in g.SettingsIniData, reused while the entry is unmodified (WriteCacheSize == 0 if none)
+    int         WriteCacheSize;
 
     ImGuiWindowSettings()       { memset(this, 0, sizeof(*this)); }
     char* GetName()             { return (char*)(this + 1); }
@@ -1312,8 +1517,18 @@ struct ImGuiSettingsHandler
     void        (*ReadLineFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, void* entry, const char* line); // Read: Called for every line of text within an ini entry
     void        (*ApplyAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler);                                // Read: Called after reading (in registration order)
     void        (*WriteAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* out_buf);      // Write: Output every entries into 'out_buf'
+    void        (*ReadBinaryFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiID entry_id, const char* data, int data_size);   // Read: Called for every entry record of a binary .ini file (optional)
+    void        (*WriteAllBinaryFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImVector<char>* out_buf, bool modified_only); // Write: Output entries as binary records using AppendIniBinaryRecord() (optional)
     void*       UserData;
 
+    // [Internal] Output of last WriteAllFn() call, stored in g.SettingsIniData. Reused on save until invalidated by MarkIniSettingsDirty().
+    // Handlers providing WriteAllBinaryFn() track modifications of individual entries: their WriteAllFn() is called on every save and may reuse
+    // the output of unmodified entries when WriteCacheValid is set. Other handlers are stored as a single text record in binary .ini files.
+    bool        WriteCacheValid;
+    int         WriteCacheOffset;
+    int         WriteCacheSize;
+    bool        WriteBinaryValid;   // Last text record written to the binary .ini journal is up to date
+
     ImGuiSettingsHandler() { memset(this, 0, sizeof(*this)); }
 };
 
@@ -1358,6 +1573,105 @@ struct IMGUI_API ImGuiStackSizes
     void CompareWithCurrentState();
 };
 
+#ifdef IMGUI_ENABLE_MEMORY_TAGS
+
+// Subsystem an allocation is accounted to (see IMGUI_MEMTAG_SCOPE)
+enum ImGuiMemTag_
+{
+    ImGuiMemTag_Other,          // Anything not allocated within a tagged scope, including your own IM_ALLOC() calls
+    ImGuiMemTag_Windows,        // ImGuiWindow, ImGuiWindowTempData stacks
+    ImGuiMemTag_DrawLists,      // ImDrawList buffers and channels, ImDrawData
+    ImGuiMemTag_Tables,         // ImGuiTable, table RawData, ImGuiTableTempData
+    ImGuiMemTag_InputText,      // ImGuiInputTextState buffers
+    ImGuiMemTag_Fonts,          // ImFontAtlas, ImFont glyphs and lookup tables, font data, texture
+    ImGuiMemTag_Settings,       // Windows and tables .ini settings, .ini text
+    ImGuiMemTag_COUNT
+};
+
+struct ImGuiMemTagStats
+{
+    ImS64       Bytes;          // Currently allocated (excluding headers)
+    ImS64       BytesPeak;      // High-water mark of Bytes
+    int         Count;          // Active allocations
+    int         CountPeak;      // High-water mark of Count
+    ImU64       CountTotal;     // Number of allocations made, to spot churn
+
+    ImGuiMemTagStats() { memset(this, 0, sizeof(*this)); }
+};
+
+#endif // #ifdef IMGUI_ENABLE_MEMORY_TAGS
+
+#ifdef IMGUI_ENABLE_PROFILER
+
+// Timed scope recorded by the frame profiler (see IMGUI_PROFILER_SCOPE)
+// Consecutive calls to the same scope under the same parent are merged into a single entry.
+struct ImGuiProfilerEntry
+{
+    const char* Name;               // Static string, e.g. "NavUpdate"
+    const char* Label;              // Optional, e.g. window name. Needs to stay valid for as long as the frame is kept in history.
+    ImGuiID     ID;                 // Optional, e.g. table ID
+    int         Depth;
+    int         Count;              // Number of calls merged in this entry
+    int         LastChildIdx;       // Last child entry, which the next call to the same child scope may be merged with
+    ImU64       TimeBegin;          // Start of the first call (nanoseconds)
+    ImU64       TimeEnd;            // End of the last call
+    ImU64       TimeTotal;          // Sum of the duration of the calls (<= TimeEnd - TimeBegin)
+    ImU64       TimeResumed;        // Start of the call in progress
+};
+
+// Profiler data for one frame, from NewFrame() to the end of Render()
+struct ImGuiProfilerFrame
+{
+    int                             FrameCount;     // Value of g.FrameCount
+    int                             MaxDepth;
+    int                             LastRootIdx;    // Last entry with Depth == 0
+    ImU64                           TimeBegin;
+    ImU64                           TimeEnd;
+    ImVector<ImGuiProfilerEntry>    Entries;
+
+    ImGuiProfilerFrame() { FrameCount = -1; MaxDepth = LastRootIdx = 0; TimeBegin = TimeEnd = 0; }
+};
+
+// Frame profiler: keep a history of the last frames, displayed in Metrics window.
+// NewFrame()/EndFrame()/Render() are delimited by context hooks, other scopes by IMGUI_PROFILER_SCOPE() or IMGUI_PROFILER_BEGIN()/IMGUI_PROFILER_END().
+struct ImGuiProfiler
+{
+    bool                Recording;          // Recording the current frame
+    bool                Paused;             // Don't record new frames (set from Metrics window)
+    int                 FrameIdx;           // Frame being recorded or last recorded, in Frames[]
+    int                 FramesCount;        // Number of complete frames in Frames[]
+    int                 SelectedFrame;      // Frame displayed in Metrics window, as a number of frames before the last complete frame
+    int                 PhaseStackSize;     // Size of Stack when the current NewFrame()/EndFrame()/Render() scope was opened
+    ImU64               ClockFrequency;     // Ticks per second of the clock used for timings, queried by Initialize()
+    ImVector<int>       Stack;              // Entries in progress
+    ImGuiProfilerFrame  Frames[120];
+
+    // Trace export (see ProfilerTraceToFile(), ProfilerTraceToCallback())
+    ImGuiID             TraceHookIds[2];        // Context hooks writing recorded frames, 0 when not tracing
+    int                 TraceLastFrameCount;    // Last frame written
+    int                 TraceEventsCount;
+    ImFileHandle        TraceFile;
+    ImGuiLogCallback    TraceCallback;
+    void*               TraceCallbackUserData;
+    ImGuiTextBuffer     TraceBuffer;
+
+    ImGuiProfiler()
+    {
+        Recording = Paused = false;
+        FrameIdx = -1;
+        FramesCount = SelectedFrame = PhaseStackSize = 0;
+        ClockFrequency = 0;
+        TraceHookIds[0] = TraceHookIds[1] = 0;
+        TraceLastFrameCount = -1;
+        TraceEventsCount = 0;
+        TraceFile = NULL;
+        TraceCallback = NULL;
+        TraceCallbackUserData = NULL;
+    }
+};
+
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
 //-----------------------------------------------------------------------------
 // [SECTION] Generic context hooks
 //-----------------------------------------------------------------------------
@@ -1402,6 +1716,9 @@ struct ImGuiContext
     ImGuiID                 TestEngineHookIdInfo;               // Will call test engine hooks: ImGuiTestEngineHook_IdInfo() from GetID()
     void*                   TestEngine;                         // Test engine user data
 
+    // Input events
+    ImVector<ImGuiInputEvent> InputEventsQueue;                 // Queued by io.AddXXXEvent() functions, applied in order by NewFrame(). Events left over by input trickling stay queued for the next frame.
+
     // Windows state
     ImVector<ImGuiWindow*>  Windows;                            // Windows, sorted in display order, back to front
     ImVector<ImGuiWindow*>  WindowsFocusOrder;                  // Root windows, sorted in focus order, back to front.
@@ -1410,6 +1727,7 @@ struct ImGuiContext
     ImGuiStorage            WindowsById;                        // Map window's ImGuiID to ImGuiWindow*
     int                     WindowsActiveCount;                 // Number of unique windows submitted by frame
     ImVec2                  WindowsHoverPadding;                // Padding around resizable windows for which hovering on counts as hovering the window == ImMax(style.TouchExtraPadding, WINDOWS_HOVER_PADDING)
+    ImGuiWindowHoverGrid    WindowsHoverGrid;                   // Spatial index of hoverable windows, used by FindHoveredWindow() when there are many windows
     ImGuiWindow*            CurrentWindow;                      // Window being drawn into
     ImGuiWindow*            HoveredWindow;                      // Window the mouse is hovering. Will typically catch mouse inputs.
     ImGuiWindow*            HoveredWindowUnderMovingWindow;     // Hovered window ignoring MovingWindow. Only set if MovingWindow is set.
@@ -1555,6 +1873,8 @@ struct ImGuiContext
     ImVector<ImGuiTableTempData>    TablesTempDataStack;
     ImVector<float>                 TablesLastTimeActive;       // Last used timestamp of each tables (SOA, for efficient GC)
     ImVector<ImDrawChannel>         DrawChannelsTempMergeBuffer;
+    int                             TablesBeginCount;           // Number of BeginTable() calls since context creation, legacy BeginColumns() calls in ColumnsBeginCount (used to detect them in cached regions)
+    int                             ColumnsBeginCount;
 
     // Tab bars
     ImGuiTabBar*                    CurrentTabBar;
@@ -1562,6 +1882,14 @@ struct ImGuiContext
     ImVector<ImGuiPtrOrIndex>       CurrentTabBarStack;
     ImVector<ImGuiShrinkWidthItem>  ShrinkWidthBuffer;
 
+    // Cached regions
+    ImPool<ImGuiCachedRegion>       CachedRegions;
+    ImVector<ImPoolIdx>             CachedRegionsStack;
+
+    // Plots
+    ImPool<ImGuiPlotLod>            PlotLods;
+    ImPool<ImGuiPlotStreamState>    PlotStreams;
+
     // Widget state
     ImVec2                  LastValidMousePos;
     ImGuiInputTextState     InputTextState;
@@ -1583,6 +1911,7 @@ struct ImGuiContext
     float                   TooltipSlowDelay;                   // Time before slow tooltips appears (FIXME: This is temporary until we merge in tooltip timer+priority work)
     ImVector<char>          ClipboardHandlerData;               // If no custom clipboard handler is defined
     ImVector<ImGuiID>       MenusIdSubmittedThisFrame;          // A list of menu IDs that were rendered at least once
+    ImGuiDataTypeFormat     DataTypeFormatCache[8];             // Recently used display formats, for RoundScalarWithFormatT()
 
     // Platform support
     ImVec2                  PlatformImePos;                     // Cursor position request & last passed to the OS Input Method Editor
@@ -1593,6 +1922,12 @@ struct ImGuiContext
     bool                    SettingsLoaded;
     float                   SettingsDirtyTimer;                 // Save .ini Settings to memory when time reaches zero
     ImGuiTextBuffer         SettingsIniData;                    // In memory .ini settings
+    ImGuiTextBuffer         SettingsIniDataPrev;                // Previous in memory .ini settings, swapped with SettingsIniData on save so output of unmodified handlers can be copied over
+    int                     SettingsIniJournalSize;             // Size of binary .ini file written during this session, when io.IniSavingBinary is set (0 if not written yet)
+    int                     SettingsIniJournalLiveSize;         // Size of binary .ini file when last rewritten from scratch. The journal gets compacted once it is twice bigger.
+    ImGuiID                 SettingsIniJournalFilenameId;       // == ImHashStr(filename) of binary .ini file written during this session
+    ImVector<char>          SettingsIniWriteBuffer;             // Data being written to disk. Kept alive while an asynchronous write is pending.
+    bool                    SettingsIniWritePending;            // Waiting for NotifyIniSettingsWriteCompleted() after calling io.IniWriteAsyncFn
     ImVector<ImGuiSettingsHandler>      SettingsHandlers;       // List of .ini settings handlers
     ImChunkStream<ImGuiWindowSettings>  SettingsWindows;        // ImGuiWindow .ini settings entries
     ImChunkStream<ImGuiTableSettings>   SettingsTables;         // ImGuiTable .ini settings entries
@@ -1603,7 +1938,9 @@ struct ImGuiContext
     bool                    LogEnabled;                         // Currently capturing
     ImGuiLogType            LogType;                            // Capture target
     ImFileHandle            LogFile;                            // If != NULL log to stdout/ file
-    ImGuiTextBuffer         LogBuffer;                          // Accumulation buffer when log to clipboard. This is pointer so our GImGui static constructor doesn't call heap allocators.
+    ImGuiLogCallback        LogCallback;                        // If != NULL log to this callback
+    void*                   LogCallbackUserData;
+    ImGuiTextBuffer         LogBuffer;                          // Accumulation buffer when log to clipboard/buffer, or pending output when log to stdout/file/callback. This is pointer so our GImGui static constructor doesn't call heap allocators.
     const char*             LogNextPrefix;
     const char*             LogNextSuffix;
     float                   LogLinePosY;
@@ -1616,6 +1953,13 @@ struct ImGuiContext
     bool                    DebugItemPickerActive;              // Item picker is active (started with DebugStartItemPicker())
     ImGuiID                 DebugItemPickerBreakId;             // Will call IM_DEBUG_BREAK() when encountering this id
     ImGuiMetricsConfig      DebugMetricsConfig;
+#ifdef IMGUI_ENABLE_PROFILER
+    ImGuiProfiler           Profiler;                           // Frame profiler, see IMGUI_ENABLE_PROFILER in imconfig.h
+#endif
+#ifdef IMGUI_ENABLE_MEMORY_TAGS
+    ImGuiMemTag             MemTag;                             // Tag of allocations made by MemAlloc(), see IMGUI_MEMTAG_SCOPE()
+    ImGuiMemTagStats        MemTagStats[ImGuiMemTag_COUNT];
+#endif
 
     // Misc
     float                   FramerateSecPerFrame[120];          // Calculate estimate of framerate for user over the last 2 seconds.
@@ -1634,6 +1978,7 @@ struct ImGuiContext
         Font = NULL;
         FontSize = FontBaseSize = 0.0f;
         IO.Fonts = shared_font_atlas ? shared_font_atlas : IM_NEW(ImFontAtlas)();
+        IO.Ctx = this;
         Time = 0.0f;
         FrameCount = 0;
         FrameCountEnded = FrameCountRendered = -1;
@@ -1732,6 +2077,7 @@ struct ImGuiContext
 
         CurrentTable = NULL;
         CurrentTableStackIdx = -1;
+        TablesBeginCount = ColumnsBeginCount = 0;
         CurrentTabBar = NULL;
 
         LastValidMousePos = ImVec2(0.0f, 0.0f);
@@ -1753,12 +2099,17 @@ struct ImGuiContext
 
         SettingsLoaded = false;
         SettingsDirtyTimer = 0.0f;
+        SettingsIniJournalSize = SettingsIniJournalLiveSize = 0;
+        SettingsIniJournalFilenameId = 0;
+        SettingsIniWritePending = false;
         HookIdNext = 0;
 
         LogEnabled = false;
         LogType = ImGuiLogType_None;
         LogNextPrefix = LogNextSuffix = NULL;
         LogFile = NULL;
+        LogCallback = NULL;
+        LogCallbackUserData = NULL;
         LogLinePosY = FLT_MAX;
         LogLineFirstItem = false;
         LogDepthRef = 0;
@@ -1766,6 +2117,9 @@ struct ImGuiContext
 
         DebugItemPickerActive = false;
         DebugItemPickerBreakId = 0;
+#ifdef IMGUI_ENABLE_MEMORY_TAGS
+        MemTag = ImGuiMemTag_Other;
+#endif
 
         memset(FramerateSecPerFrame, 0, sizeof(FramerateSecPerFrame));
         FramerateSecPerFrameIdx = FramerateSecPerFrameCount = 0;
@@ -1927,6 +2281,9 @@ struct IMGUI_API ImGuiWindow
 
     int                     MemoryDrawListIdxCapacity;          // Backup of last idx/vtx count, so when waking up the window we can preallocate and avoid iterative alloc/copy
     int                     MemoryDrawListVtxCapacity;
+    int                     MemoryDrawListIdxPeak;              // High-water mark of idx/vtx count since MemoryDrawListTrimTime
+    int                     MemoryDrawListVtxPeak;
+    float                   MemoryDrawListTrimTime;             // Last time draw list buffers were considered for trimming, see GcTrimTransientWindowBuffers()
     bool                    MemoryCompacted;                    // Set when window extraneous data have been garbage collected
 
 public:
@@ -2293,6 +2650,9 @@ struct ImGuiTableSettings
     ImGuiTableColumnIdx         ColumnsCount;
     ImGuiTableColumnIdx         ColumnsCountMax;        // Maximum number of columns this settings instance can store, we can recycle a settings instance with lower number of columns but not higher
     bool                        WantApply;              // Set when loaded from .ini data (to enable merging/loading .ini data into an already running context)
+    bool                        WantSaveBinary;         // Modified since last written to the binary .ini journal (io.IniSavingBinary)
+    int                         WriteCacheOffset;       // Output of last save in g.SettingsIniData, reused while the entry is unmodified (WriteCacheSize == 0 if none)
+    int                         WriteCacheSize;
 
     ImGuiTableSettings()        { memset(this, 0, sizeof(*this)); }
     ImGuiTableColumnSettings*   GetColumnSettings()     { return (ImGuiTableColumnSettings*)(this + 1); }
@@ -2356,11 +2716,14 @@ namespace ImGui
     // Settings
     IMGUI_API void                  MarkIniSettingsDirty();
     IMGUI_API void                  MarkIniSettingsDirty(ImGuiWindow* window);
+    IMGUI_API void                  MarkIniSettingsDirty(ImGuiSettingsHandler* handler);
+    IMGUI_API void                  MarkIniSettingsDirty(ImGuiTableSettings* settings);
     IMGUI_API void                  ClearIniSettings();
     IMGUI_API ImGuiWindowSettings*  CreateNewWindowSettings(const char* name);
     IMGUI_API ImGuiWindowSettings*  FindWindowSettings(ImGuiID id);
     IMGUI_API ImGuiWindowSettings*  FindOrCreateWindowSettings(const char* name);
     IMGUI_API ImGuiSettingsHandler* FindSettingsHandler(const char* type_name);
+    IMGUI_API char*                 AppendIniBinaryRecord(ImVector<char>* buf, ImGuiID type_hash, ImGuiID entry_id, int data_size);
 
     // Scrolling
     IMGUI_API void          SetNextWindowScroll(const ImVec2& scroll); // Use -1.0f on one axis to leave as-is
@@ -2639,6 +3002,7 @@ namespace ImGui
 
     // Plot
     IMGUI_API int           PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 frame_size);
+    IMGUI_API int           PlotStreamEx(ImGuiPlotType plot_type, const char* label, const ImGuiPlotStream& stream, const char* overlay_text, float scale_min, float scale_max, ImVec2 frame_size);
 
     // Shade functions (write over already created vertices)
     IMGUI_API void          ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1);
@@ -2648,6 +3012,8 @@ namespace ImGui
     IMGUI_API void          GcCompactTransientMiscBuffers();
     IMGUI_API void          GcCompactTransientWindowBuffers(ImGuiWindow* window);
     IMGUI_API void          GcAwakeTransientWindowBuffers(ImGuiWindow* window);
+    IMGUI_API void          GcTrimTransientWindowBuffers(ImGuiWindow* window);
+    IMGUI_API void          GcPrewarmWindow(const char* name);                  // Restore buffers of an unused window about to reappear (e.g. during a loading screen) and restart its compaction timer
 
     // Debug Tools
     IMGUI_API void          ErrorCheckEndFrameRecover(ImGuiErrorLogCallback log_callback, void* user_data = NULL);
@@ -2669,6 +3035,23 @@ namespace ImGui
     IMGUI_API void          DebugNodeViewport(ImGuiViewportP* viewport);
     IMGUI_API void          DebugRenderViewportThumbnail(ImDrawList* draw_list, ImGuiViewportP* viewport, const ImRect& bb);
 
+    // Memory accounting (when IMGUI_ENABLE_MEMORY_TAGS is defined)
+#ifdef IMGUI_ENABLE_MEMORY_TAGS
+    IMGUI_API const ImGuiMemTagStats* GetMemTagStats(ImGuiMemTag tag);                      // Stats of current context, for allocations made while it was current
+    IMGUI_API const char*   GetMemTagName(ImGuiMemTag tag);
+    IMGUI_API void          ResetMemTagPeaks();                                             // Set high-water marks to current values
+#endif
+
+    // Frame profiler (when IMGUI_ENABLE_PROFILER is defined)
+#ifdef IMGUI_ENABLE_PROFILER
+    IMGUI_API void          ProfilerScopeBegin(const char* name, const char* label = NULL, ImGuiID id = 0);
+    IMGUI_API void          ProfilerScopeEnd();
+    IMGUI_API void          ProfilerTraceToFile(const char* filename);                          // Stream recorded frames to a Chrome Trace Event JSON file (open in chrome://tracing or ui.perfetto.dev)
+    IMGUI_API void          ProfilerTraceToCallback(ImGuiLogCallback callback, void* user_data); // Stream the same JSON text to your own sink, one chunk per frame
+    IMGUI_API void          ProfilerTraceFinish();
+    IMGUI_API void          DebugNodeProfiler(ImGuiProfiler* profiler);
+#endif
+
 } // namespace ImGui
 
 
@@ -2712,6 +3095,42 @@ extern void         ImGuiTestEngineHook_Log(ImGuiContext* ctx, const char* fmt,
 #define IMGUI_TEST_ENGINE_ITEM_INFO(_ID,_LABEL,_FLAGS)      ((void)0)
 #endif
 
+//-----------------------------------------------------------------------------
+// [SECTION] Frame profiler (IMGUI_ENABLE_PROFILER)
+//-----------------------------------------------------------------------------
+
+#ifdef IMGUI_ENABLE_PROFILER
+struct ImGuiProfilerScope
+{
+    ImGuiProfilerScope(const char* name, const char* label, ImGuiID id) { ImGui::ProfilerScopeBegin(name, label, id); }
+    ~ImGuiProfilerScope()                                               { ImGui::ProfilerScopeEnd(); }
+};
+#define IMGUI_PROFILER_SCOPE(_NAME,_LABEL,_ID)              ImGuiProfilerScope imgui_profiler_scope(_NAME, _LABEL, _ID)    // Time until the end of the C++ scope
+#define IMGUI_PROFILER_BEGIN(_NAME,_LABEL,_ID)              ImGui::ProfilerScopeBegin(_NAME, _LABEL, _ID)
+#define IMGUI_PROFILER_END()                                ImGui::ProfilerScopeEnd()
+#else
+#define IMGUI_PROFILER_SCOPE(_NAME,_LABEL,_ID)              ((void)0)
+#define IMGUI_PROFILER_BEGIN(_NAME,_LABEL,_ID)              ((void)0)
+#define IMGUI_PROFILER_END()                                ((void)0)
+#endif
+
+//-----------------------------------------------------------------------------
+// [SECTION] Memory tags (IMGUI_ENABLE_MEMORY_TAGS)
+//-----------------------------------------------------------------------------
+
+#ifdef IMGUI_ENABLE_MEMORY_TAGS
+struct ImGuiMemTagScope
+{
+    ImGuiContext*   Ctx;
+    ImGuiMemTag     BackupTag;
+    ImGuiMemTagScope(ImGuiMemTag tag)   { Ctx = GImGui; BackupTag = ImGuiMemTag_Other; if (Ctx) { BackupTag = Ctx->MemTag; Ctx->MemTag = tag; } }
+    ~ImGuiMemTagScope()                 { if (Ctx) Ctx->MemTag = BackupTag; }
+};
+#define IMGUI_MEMTAG_SCOPE(_TAG)                            ImGuiMemTagScope imgui_memtag_scope(_TAG)    // Account allocations to _TAG until the end of the C++ scope
+#else
+#define IMGUI_MEMTAG_SCOPE(_TAG)                            ((void)0)
+#endif
+
 //-----------------------------------------------------------------------------
 
 #if defined(__clang__)
@@ -315,6 +315,7 @@ bool    ImGui::BeginTable(const char* str_id, int columns_count, ImGuiTableFlags
 bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImGuiTableFlags flags, const ImVec2& outer_size, float inner_width)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_Tables);
     ImGuiWindow* outer_window = GetCurrentWindow();
     if (outer_window->SkipItems) // Consistent with other tables + beneficial side effect that assert on miscalling EndTable() will be more visible.
         return false;
@@ -345,6 +346,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
 
     // Acquire temporary buffers
     const int table_idx = g.Tables.GetIndex(table);
+    g.TablesBeginCount++;
     g.CurrentTableStackIdx++;
     if (g.CurrentTableStackIdx + 1 > g.TablesTempDataStack.Size)
         g.TablesTempDataStack.resize(g.CurrentTableStackIdx + 1, ImGuiTableTempData());
@@ -719,6 +721,7 @@ static void TableSetupColumnFlags(ImGuiTable* table, ImGuiTableColumn* column, I
 void ImGui::TableUpdateLayout(ImGuiTable* table)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_PROFILER_SCOPE("TableUpdateLayout", table->OuterWindow->Name, table->ID);
     IM_ASSERT(table->IsLayoutLocked == false);
 
     const ImGuiTableFlags table_sizing_policy = (table->Flags & ImGuiTableFlags_SizingMask_);
@@ -1200,6 +1203,7 @@ void ImGui::TableUpdateBorders(ImGuiTable* table)
 void    ImGui::EndTable()
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_Tables);
     ImGuiTable* table = g.CurrentTable;
     IM_ASSERT(table != NULL && "Only call EndTable() if BeginTable() returns true!");
 
@@ -1403,6 +1407,7 @@ void    ImGui::EndTable()
 void ImGui::TableSetupColumn(const char* label, ImGuiTableColumnFlags flags, float init_width_or_weight, ImGuiID user_id)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_Tables);
     ImGuiTable* table = g.CurrentTable;
     IM_ASSERT(table != NULL && "Need to call TableSetupColumn() after BeginTable()!");
     IM_ASSERT(table->IsLayoutLocked == false && "Need to call call TableSetupColumn() before first row!");
@@ -2326,6 +2331,8 @@ void ImGui::TableSetupDrawChannels(ImGuiTable* table)
 void ImGui::TableMergeDrawChannels(ImGuiTable* table)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_Tables);
+    IMGUI_PROFILER_SCOPE("TableMergeDrawChannels", table->OuterWindow->Name, table->ID);
     ImDrawListSplitter* splitter = table->DrawSplitter;
     const bool has_freeze_v = (table->FreezeRowsCount > 0);
     const bool has_freeze_h = (table->FreezeColumnsCount > 0);
@@ -3130,6 +3137,8 @@ void ImGui::TableDrawContextMenu(ImGuiTable* table)
 // - TableSettingsHandler_ReadOpen() [Internal]
 // - TableSettingsHandler_ReadLine() [Internal]
 // - TableSettingsHandler_WriteAll() [Internal]
+// - TableSettingsHandler_ReadBinary() [Internal]
+// - TableSettingsHandler_WriteAllBinary() [Internal]
 // - TableSettingsInstallHandler() [Internal]
 //-------------------------------------------------------------------------
 // [Init] 1: TableSettingsHandler_ReadXXXX()   Load and parse .ini file into TableSettings.
@@ -3159,6 +3168,7 @@ static size_t TableSettingsCalcChunkSize(int columns_count)
 ImGuiTableSettings* ImGui::TableSettingsCreate(ImGuiID id, int columns_count)
 {
     ImGuiContext& g = *GImGui;
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_Settings);
     ImGuiTableSettings* settings = g.SettingsTables.alloc_chunk(TableSettingsCalcChunkSize(columns_count));
     TableSettingsInit(settings, id, columns_count, columns_count);
     return settings;
@@ -3251,7 +3261,7 @@ void ImGui::TableSaveSettings(ImGuiTable* table)
     settings->SaveFlags &= table->Flags;
     settings->RefScale = save_ref_scale ? table->RefScale : 0.0f;
 
-    MarkIniSettingsDirty();
+    MarkIniSettingsDirty(settings);
 }
 
 void ImGui::TableLoadSettings(ImGuiTable* table)
@@ -3340,13 +3350,8 @@ static void TableSettingsHandler_ApplyAll(ImGuiContext* ctx, ImGuiSettingsHandle
         }
 }
 
-static void* TableSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
+static ImGuiTableSettings* TableSettingsHandler_RecycleOrCreate(ImGuiID id, int columns_count)
 {
-    ImGuiID id = 0;
-    int columns_count = 0;
-    if (sscanf(name, "0x%08X,%d", &id, &columns_count) < 2)
-        return NULL;
-
     if (ImGuiTableSettings* settings = ImGui::TableSettingsFindByID(id))
     {
         if (settings->ColumnsCountMax >= columns_count)
@@ -3359,6 +3364,15 @@ static void* TableSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*,
     return ImGui::TableSettingsCreate(id, columns_count);
 }
 
+static void* TableSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
+{
+    ImGuiID id = 0;
+    int columns_count = 0;
+    if (sscanf(name, "0x%08X,%d", &id, &columns_count) < 2)
+        return NULL;
+    return TableSettingsHandler_RecycleOrCreate(id, columns_count);
+}
+
 static void TableSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line)
 {
     // "Column 0  UserID=0x42AD2D21 Width=100 Visible=1 Order=0 Sort=0v"
@@ -3387,12 +3401,25 @@ static void TableSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*,
 
 static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
 {
+    // Copy over output of the previous save for unmodified entries (see TableSaveSettings())
     ImGuiContext& g = *ctx;
+    const bool use_write_cache = (buf == &g.SettingsIniData);
+    const ImGuiTextBuffer& prev_buf = g.SettingsIniDataPrev;
     for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
     {
         if (settings->ID == 0) // Skip ditched settings
             continue;
 
+        const int write_offset = buf->size();
+        if (use_write_cache && handler->WriteCacheValid && settings->WriteCacheSize > 0 && settings->WriteCacheOffset + settings->WriteCacheSize <= prev_buf.size())
+        {
+            buf->append(prev_buf.begin() + settings->WriteCacheOffset, prev_buf.begin() + settings->WriteCacheOffset + settings->WriteCacheSize);
+            settings->WriteCacheOffset = write_offset;
+            continue;
+        }
+        if (use_write_cache)
+            settings->WriteCacheSize = 0;
+
         // TableSaveSettings() may clear some of those flags when we establish that the data can be stripped
         // (e.g. Order was unchanged)
         const bool save_size    = (settings->SaveFlags & ImGuiTableFlags_Resizable) != 0;
@@ -3423,6 +3450,70 @@ static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandle
             buf->append("\n");
         }
         buf->append("\n");
+        if (use_write_cache)
+        {
+            settings->WriteCacheOffset = write_offset;
+            settings->WriteCacheSize = buf->size() - write_offset;
+        }
+    }
+}
+
+// Binary record: ImS32 SaveFlags, float RefScale, ImS8 ColumnsCount, then for each column:
+// float WidthOrWeight, ImU32 UserID, ImS8 Index, ImS8 DisplayOrder, ImS8 SortOrder, ImU8 SortDirection | IsEnabled << 2 | IsStretch << 3
+static const int TableSettingsBinaryHeaderSize = 4 + 4 + 1;
+static const int TableSettingsBinaryColumnSize = 4 + 4 + 1 + 1 + 1 + 1;
+
+static void TableSettingsHandler_ReadBinary(ImGuiContext*, ImGuiSettingsHandler*, ImGuiID id, const char* data, int data_size)
+{
+    if (data_size < TableSettingsBinaryHeaderSize)
+        return;
+    const int columns_count = (ImS8)data[8];
+    if (columns_count < 0 || data_size != TableSettingsBinaryHeaderSize + columns_count * TableSettingsBinaryColumnSize)
+        return;
+    ImGuiTableSettings* settings = TableSettingsHandler_RecycleOrCreate(id, columns_count);
+    memcpy(&settings->SaveFlags, data, 4);
+    memcpy(&settings->RefScale, data + 4, 4);
+    data += TableSettingsBinaryHeaderSize;
+    ImGuiTableColumnSettings* column = settings->GetColumnSettings();
+    for (int column_n = 0; column_n < columns_count; column_n++, column++, data += TableSettingsBinaryColumnSize)
+    {
+        memcpy(&column->WidthOrWeight, data, 4);
+        memcpy(&column->UserID, data + 4, 4);
+        column->Index = (ImGuiTableColumnIdx)data[8];
+        column->DisplayOrder = (ImGuiTableColumnIdx)data[9];
+        column->SortOrder = (ImGuiTableColumnIdx)data[10];
+        column->SortDirection = (ImU8)(data[11] & 0x03);
+        column->IsEnabled = (ImU8)((data[11] >> 2) & 1);
+        column->IsStretch = (ImU8)((data[11] >> 3) & 1);
+    }
+}
+
+static void TableSettingsHandler_WriteAllBinary(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImVector<char>* buf, bool modified_only)
+{
+    ImGuiContext& g = *ctx;
+    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
+    {
+        if (settings->ID == 0) // Skip ditched settings
+            continue;
+        if (modified_only && !settings->WantSaveBinary)
+            continue;
+        const int columns_count = settings->ColumnsCount;
+        char* data = ImGui::AppendIniBinaryRecord(buf, handler->TypeHash, settings->ID, TableSettingsBinaryHeaderSize + columns_count * TableSettingsBinaryColumnSize);
+        memcpy(data, &settings->SaveFlags, 4);
+        memcpy(data + 4, &settings->RefScale, 4);
+        data[8] = (char)settings->ColumnsCount;
+        data += TableSettingsBinaryHeaderSize;
+        const ImGuiTableColumnSettings* column = settings->GetColumnSettings();
+        for (int column_n = 0; column_n < columns_count; column_n++, column++, data += TableSettingsBinaryColumnSize)
+        {
+            memcpy(data, &column->WidthOrWeight, 4);
+            memcpy(data + 4, &column->UserID, 4);
+            data[8] = (char)column->Index;
+            data[9] = (char)column->DisplayOrder;
+            data[10] = (char)column->SortOrder;
+            data[11] = (char)(column->SortDirection | (column->IsEnabled << 2) | (column->IsStretch << 3));
+        }
+        settings->WantSaveBinary = false;
     }
 }
 
@@ -3437,6 +3528,8 @@ void ImGui::TableSettingsInstallHandler(ImGuiContext* context)
     ini_handler.ReadLineFn = TableSettingsHandler_ReadLine;
     ini_handler.ApplyAllFn = TableSettingsHandler_ApplyAll;
     ini_handler.WriteAllFn = TableSettingsHandler_WriteAll;
+    ini_handler.ReadBinaryFn = TableSettingsHandler_ReadBinary;
+    ini_handler.WriteAllBinaryFn = TableSettingsHandler_WriteAllBinary;
     g.SettingsHandlers.push_back(ini_handler);
 }
 
@@ -3829,6 +3922,7 @@ void ImGui::BeginColumns(const char* str_id, int columns_count, ImGuiOldColumnFl
 
     IM_ASSERT(columns_count >= 1);
     IM_ASSERT(window->DC.CurrentColumns == NULL);   // Nested columns are currently not supported
+    g.ColumnsBeginCount++;
 
     // Acquire storage for the columns set
     ImGuiID id = GetColumnsID(str_id, columns_count);
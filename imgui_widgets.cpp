@@ -2175,14 +2175,104 @@ static void SanitizeFormatString(const char* fmt, char* fmt_out, size_t fmt_out_
     *fmt_out = 0; // Zero-terminate
 }
 
+// Parse the specifier of a display format (for RoundScalarWithFormatT), reusing the result of a previous call with the same format string.
+static const ImGuiDataTypeFormat* GetDataTypeFormat(const char* format)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiDataTypeFormat* entry = &g.DataTypeFormatCache[((size_t)format >> 2) % IM_ARRAYSIZE(g.DataTypeFormatCache)];
+    if (entry->Format == format)
+    {
+        const char* copy = entry->FormatCopy;
+        const char* p = format;
+        while (*copy != 0 && *copy == *p)
+        {
+            copy++;
+            p++;
+        }
+        if (*copy == 0)
+            return entry;
+    }
+
+    entry->Format = NULL;
+    entry->FormatCopy[0] = 0;
+    entry->Conversion = 0;
+    entry->Precision = -1;
+    entry->ArgSize = 0;
+    const char* fmt_start = ImParseFormatFindStart(format);
+    if (fmt_start[0] != '%' || fmt_start[1] == '%') // Value is not visible in the format string (not cached as the whole string would need to be compared)
+        return entry;
+
+    // Flags, width, precision
+    const char* fmt_end = ImParseFormatFindEnd(fmt_start);
+    const char* p = fmt_start + 1;
+    while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0' || *p == '\'' || *p == '$' || *p == '_')
+        p++;
+    while (*p >= '0' && *p <= '9')
+        p++;
+    if (*p == '.')
+    {
+        int precision = 0;
+        for (p++; *p >= '0' && *p <= '9'; p++)
+            precision = ImMin(precision * 10 + (*p - '0'), 127);
+        entry->Precision = (ImS8)precision;
+    }
+
+    // Length modifiers: size of the integer argument read by the specifier
+    int arg_size = (int)sizeof(int);
+    bool length_modifier = true;
+    if (p[0] == 'h')                                    { arg_size = 0; p += (p[1] == 'h') ? 2 : 1; }
+    else if (p[0] == 'l' && p[1] == 'l')                { arg_size = 8; p += 2; }
+    else if (p[0] == 'l')                               { arg_size = (int)sizeof(long); p++; }
+    else if (p[0] == 'j')                               { arg_size = 8; p++; }
+    else if (p[0] == 'z')                               { arg_size = (int)sizeof(size_t); p++; }
+    else if (p[0] == 't')                               { arg_size = (int)sizeof(ptrdiff_t); p++; }
+#ifdef _MSC_VER
+    else if (p[0] == 'I' && p[1] == '6' && p[2] == '4') { arg_size = 8; p += 3; }
+#endif
+    else                                                { length_modifier = false; }
+
+    const char c = *p;
+    entry->Conversion = (p + 1 == fmt_end && c != '*') ? c : '?';
+    if (c == 'd' || c == 'i' || c == 'u' || c == 'x' || c == 'X' || c == 'o')
+        entry->ArgSize = (ImS8)arg_size;
+    else if (c == 'f' || c == 'F' || c == 'e' || c == 'E' || c == 'g' || c == 'G' || c == 'a' || c == 'A')
+        entry->ArgSize = (!length_modifier || p[-1] == 'l') ? (ImS8)sizeof(double) : 0;
+
+    // Keep for next call
+    const size_t copy_len = (size_t)(fmt_end - format);
+    if (copy_len < IM_ARRAYSIZE(entry->FormatCopy))
+    {
+        memcpy(entry->FormatCopy, format, copy_len);
+        entry->FormatCopy[copy_len] = 0;
+        entry->Format = format;
+    }
+    return entry;
+}
+
 template<typename TYPE, typename SIGNEDTYPE>
 TYPE ImGui::RoundScalarWithFormatT(const char* format, ImGuiDataType data_type, TYPE v)
 {
-    const char* fmt_start = ImParseFormatFindStart(format);
-    if (fmt_start[0] != '%' || fmt_start[1] == '%') // Don't apply if the value is not visible in the format string
+    const ImGuiDataTypeFormat* data_format = GetDataTypeFormat(format);
+    if (data_format->Conversion == 0) // Don't apply if the value is not visible in the format string
         return v;
 
+    // Fast path: compute the result of the round-trip below without going through text
+    const char c = data_format->Conversion;
+    if (data_type == ImGuiDataType_Float || data_type == ImGuiDataType_Double)
+    {
+#ifndef IMGUI_DISABLE_DEFAULT_FORMAT_FUNCTIONS
+        double v_rounded;
+        if ((c == 'f' || c == 'F') && data_format->ArgSize == sizeof(double) && ImFormatRoundDouble((double)v, (data_format->Precision < 0) ? 6 : data_format->Precision, &v_rounded))
+            return (TYPE)v_rounded;
+#endif
+    }
+    else if ((c == 'd' || c == 'i' || c == 'u') && data_format->ArgSize >= (int)sizeof(TYPE))
+    {
+        return v; // Integers are displayed with all their digits and read back (wrapping) to the same value
+    }
+
     // Sanitize format
+    const char* fmt_start = ImParseFormatFindStart(format);
     char fmt_sanitized[32];
     SanitizeFormatString(fmt_start, fmt_sanitized, IM_ARRAYSIZE(fmt_sanitized));
     fmt_start = fmt_sanitized;
@@ -3945,6 +4035,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     ImGuiContext& g = *GImGui;
     ImGuiIO& io = g.IO;
     const ImGuiStyle& style = g.Style;
+    IMGUI_MEMTAG_SCOPE(ImGuiMemTag_InputText);
 
     const bool RENDER_SELECTION_WHEN_INACTIVE = false;
     const bool is_multiline = (flags & ImGuiInputTextFlags_Multiline) != 0;
@@ -6377,8 +6468,10 @@ bool ImGui::ListBox(const char* label, int* current_item, bool (*items_getter)(v
 // [SECTION] Widgets: PlotLines, PlotHistogram
 //-------------------------------------------------------------------------
 // - PlotEx() [Internal]
+// - PlotStreamEx() [Internal]
 // - PlotLines()
 // - PlotHistogram()
+// - SetNextPlotDataVersion()
 //-------------------------------------------------------------------------
 // Plot/Graph widgets are not very good.
 // Consider writing your own, or using a third-party one, see:
@@ -6386,6 +6479,150 @@ bool ImGui::ListBox(const char* label, int* current_item, bool (*items_getter)(v
 // - others https://github.com/ocornut/imgui/wiki/Useful-Extensions
 //-------------------------------------------------------------------------
 
+struct ImGuiPlotArrayGetterData
+{
+    const float* Values;
+    int Stride;
+
+    ImGuiPlotArrayGetterData(const float* values, int stride) { Values = values; Stride = stride; }
+};
+
+static float Plot_ArrayGetter(void* data, int idx)
+{
+    ImGuiPlotArrayGetterData* plot_data = (ImGuiPlotArrayGetterData*)data;
+    const float v = *(const float*)(const void*)((const unsigned char*)plot_data->Values + (size_t)idx * plot_data->Stride);
+    return v;
+}
+
+// Level-of-detail for plots with more values than pixels: each pixel column displays the min/max of the values it covers.
+// The min/max of any range of values is obtained from the ImGuiPlotLod pyramid by visiting O(log N) nodes, plus the values
+// of the partial blocks at both ends of the range, so the per-frame cost is O(pixels) when the pyramid can be reused.
+static const int PLOT_LOD_BLOCK_SIZE = 32;
+
+// Accumulate the min/max of 'count' contiguous values, ignoring NaN values.
+static void PlotReduceMinMax(const float* values, int count, float* io_min, float* io_max)
+{
+    float v_min = *io_min;
+    float v_max = *io_max;
+    int n = 0;
+#ifdef IMGUI_ENABLE_SSE
+    if (count >= 8)
+    {
+        // _mm_min_ps()/_mm_max_ps() return their second operand when either is NaN, so NaN values are ignored
+        __m128 min0 = _mm_set1_ps(v_min), min1 = min0;
+        __m128 max0 = _mm_set1_ps(v_max), max1 = max0;
+        for (; n + 8 <= count; n += 8)
+        {
+            const __m128 v0 = _mm_loadu_ps(values + n);
+            const __m128 v1 = _mm_loadu_ps(values + n + 4);
+            min0 = _mm_min_ps(v0, min0);
+            min1 = _mm_min_ps(v1, min1);
+            max0 = _mm_max_ps(v0, max0);
+            max1 = _mm_max_ps(v1, max1);
+        }
+        float mins[4], maxs[4];
+        _mm_storeu_ps(mins, _mm_min_ps(min0, min1));
+        _mm_storeu_ps(maxs, _mm_max_ps(max0, max1));
+        v_min = ImMin(ImMin(mins[0], mins[1]), ImMin(mins[2], mins[3]));
+        v_max = ImMax(ImMax(maxs[0], maxs[1]), ImMax(maxs[2], maxs[3]));
+    }
+#endif
+    for (; n < count; n++)
+    {
+        const float v = values[n];
+        if (v != v) // Ignore NaN values
+            continue;
+        v_min = ImMin(v_min, v);
+        v_max = ImMax(v_max, v);
+    }
+    *io_min = v_min;
+    *io_max = v_max;
+}
+
+// Accumulate the min/max of values [idx_min, idx_max) in storage order. 'contiguous_values' is non-NULL for arrays of tightly packed floats.
+static void PlotReduceMinMax(float (*values_getter)(void* data, int idx), void* data, const float* contiguous_values, int idx_min, int idx_max, float* io_min, float* io_max)
+{
+    if (contiguous_values)
+    {
+        PlotReduceMinMax(contiguous_values + idx_min, idx_max - idx_min, io_min, io_max);
+        return;
+    }
+    for (int idx = idx_min; idx < idx_max; idx++)
+    {
+        const float v = values_getter(data, idx);
+        if (v != v) // Ignore NaN values
+            continue;
+        *io_min = ImMin(*io_min, v);
+        *io_max = ImMax(*io_max, v);
+    }
+}
+
+static void PlotLodBuild(ImGuiPlotLod* lod, float (*values_getter)(void* data, int idx), void* data, const float* contiguous_values, int values_count)
+{
+    lod->LevelOffsets.resize(0);
+    int nodes_count = 0;
+    for (int level_size = (values_count + PLOT_LOD_BLOCK_SIZE - 1) / PLOT_LOD_BLOCK_SIZE; ; level_size = (level_size + 1) / 2)
+    {
+        lod->LevelOffsets.push_back(nodes_count);
+        nodes_count += level_size;
+        if (level_size <= 1)
+            break;
+    }
+    lod->LevelOffsets.push_back(nodes_count);
+    lod->Nodes.resize(nodes_count);
+
+    // First level: reduce blocks of values
+    ImVec2* nodes = lod->Nodes.Data;
+    for (int block_n = 0, level_size = lod->LevelOffsets[1]; block_n < level_size; block_n++)
+    {
+        ImVec2 node(FLT_MAX, -FLT_MAX);
+        PlotReduceMinMax(values_getter, data, contiguous_values, block_n * PLOT_LOD_BLOCK_SIZE, ImMin((block_n + 1) * PLOT_LOD_BLOCK_SIZE, values_count), &node.x, &node.y);
+        nodes[block_n] = node;
+    }
+
+    // Following levels: reduce pairs of nodes of the previous level (an odd last node is copied)
+    for (int level = 1; level < lod->LevelOffsets.Size - 1; level++)
+    {
+        const ImVec2* src = nodes + lod->LevelOffsets[level - 1];
+        const int src_size = lod->LevelOffsets[level] - lod->LevelOffsets[level - 1];
+        ImVec2* dst = nodes + lod->LevelOffsets[level];
+        for (int n = 0; n < src_size; n += 2)
+            dst[n >> 1] = (n + 1 < src_size) ? ImVec2(ImMin(src[n].x, src[n + 1].x), ImMax(src[n].y, src[n + 1].y)) : src[n];
+    }
+}
+
+// Accumulate the min/max of values [idx_min, idx_max) in storage order, using the pyramid for whole blocks.
+static void PlotLodReduceMinMax(const ImGuiPlotLod* lod, float (*values_getter)(void* data, int idx), void* data, const float* contiguous_values, int idx_min, int idx_max, float* io_min, float* io_max)
+{
+    int block_min = (idx_min + PLOT_LOD_BLOCK_SIZE - 1) / PLOT_LOD_BLOCK_SIZE;
+    int block_max = idx_max / PLOT_LOD_BLOCK_SIZE;
+    if (block_min >= block_max)
+    {
+        PlotReduceMinMax(values_getter, data, contiguous_values, idx_min, idx_max, io_min, io_max);
+        return;
+    }
+    PlotReduceMinMax(values_getter, data, contiguous_values, idx_min, block_min * PLOT_LOD_BLOCK_SIZE, io_min, io_max);
+    PlotReduceMinMax(values_getter, data, contiguous_values, block_max * PLOT_LOD_BLOCK_SIZE, idx_max, io_min, io_max);
+    for (int level = 0; block_min < block_max; level++)
+    {
+        const ImVec2* nodes = lod->Nodes.Data + lod->LevelOffsets[level];
+        if (block_min & 1)
+        {
+            *io_min = ImMin(*io_min, nodes[block_min].x);
+            *io_max = ImMax(*io_max, nodes[block_min].y);
+            block_min++;
+        }
+        if (block_max & 1)
+        {
+            block_max--;
+            *io_min = ImMin(*io_min, nodes[block_max].x);
+            *io_max = ImMax(*io_max, nodes[block_max].y);
+        }
+        block_min >>= 1;
+        block_max >>= 1;
+    }
+}
+
 int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 frame_size)
 {
     ImGuiContext& g = *GImGui;
@@ -6395,6 +6632,8 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
 
     const ImGuiStyle& style = g.Style;
     const ImGuiID id = window->GetID(label);
+    const bool has_data_version = (g.NextItemData.Flags & ImGuiNextItemDataFlags_HasPlotDataVersion) != 0; // Cleared by ItemAdd()
+    const ImU32 data_version = g.NextItemData.PlotDataVersion;
 
     const ImVec2 label_size = CalcTextSize(label, NULL, true);
     if (frame_size.x == 0.0f)
@@ -6410,18 +6649,53 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
         return -1;
     const bool hovered = ItemHoverable(frame_bb, id);
 
+    // Use level-of-detail when there are more values than pixels
+    const int lod_res_w = (int)(inner_bb.Max.x - inner_bb.Min.x);
+    const float* contiguous_values = NULL;
+    ImGuiPlotLod* lod = NULL;
+    if (lod_res_w > 0 && values_count > lod_res_w)
+    {
+        const ImGuiPlotArrayGetterData* array_data = (values_getter == &Plot_ArrayGetter) ? (const ImGuiPlotArrayGetterData*)data : NULL;
+        const void* data_source = array_data ? (const void*)array_data->Values : data;
+        const int data_stride = array_data ? array_data->Stride : 0;
+        if (array_data && array_data->Stride == (int)sizeof(float))
+            contiguous_values = array_data->Values;
+
+        lod = g.PlotLods.GetOrAddByKey(id);
+        const bool lod_is_valid = has_data_version && lod->HasDataVersion && lod->DataVersion == data_version && lod->Nodes.Size > 0
+            && lod->ValuesGetter == values_getter && lod->DataSource == data_source && lod->DataStride == data_stride && lod->ValuesCount == values_count;
+        if (!lod_is_valid)
+            PlotLodBuild(lod, values_getter, data, contiguous_values, values_count);
+        lod->ID = id;
+        lod->ValuesGetter = values_getter;
+        lod->DataSource = data_source;
+        lod->DataStride = data_stride;
+        lod->ValuesCount = values_count;
+        lod->DataVersion = data_version;
+        lod->HasDataVersion = has_data_version;
+        lod->LastTimeActive = (float)g.Time;
+    }
+
     // Determine scale from values if not specified
     if (scale_min == FLT_MAX || scale_max == FLT_MAX)
     {
         float v_min = FLT_MAX;
         float v_max = -FLT_MAX;
-        for (int i = 0; i < values_count; i++)
+        if (lod != NULL)
         {
-            const float v = values_getter(data, i);
-            if (v != v) // Ignore NaN values
-                continue;
-            v_min = ImMin(v_min, v);
-            v_max = ImMax(v_max, v);
+            v_min = lod->Nodes.back().x;
+            v_max = lod->Nodes.back().y;
+        }
+        else
+        {
+            for (int i = 0; i < values_count; i++)
+            {
+                const float v = values_getter(data, i);
+                if (v != v) // Ignore NaN values
+                    continue;
+                v_min = ImMin(v_min, v);
+                v_max = ImMax(v_max, v);
+            }
         }
         if (scale_min == FLT_MAX)
             scale_min = v_min;
@@ -6465,7 +6739,50 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
         const ImU32 col_base = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLines : ImGuiCol_PlotHistogram);
         const ImU32 col_hovered = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLinesHovered : ImGuiCol_PlotHistogramHovered);
 
-        for (int n = 0; n < res_w; n++)
+        // Level-of-detail: one vertical span per pixel column, covering the min/max of the values of the column.
+        // Spans of lines are extended to reach the span of the previous column, so the plot stays continuous.
+        const float histogram_zero_line_y = ImLerp(inner_bb.Min.y, inner_bb.Max.y, histogram_zero_line_t);
+        float prev_v_min = FLT_MAX;
+        float prev_v_max = -FLT_MAX;
+        for (int n = 0; lod != NULL && n < lod_res_w; n++)
+        {
+            const int v_idx_min = (int)((ImS64)values_count * n / lod_res_w);
+            const int v_idx_max = (int)((ImS64)values_count * (n + 1) / lod_res_w);
+            const int idx_min = (v_idx_min + values_offset) % values_count;
+            const int idx_max = idx_min + (v_idx_max - v_idx_min);
+            float v_min = FLT_MAX;
+            float v_max = -FLT_MAX;
+            PlotLodReduceMinMax(lod, values_getter, data, contiguous_values, idx_min, ImMin(idx_max, values_count), &v_min, &v_max);
+            if (idx_max > values_count)
+                PlotLodReduceMinMax(lod, values_getter, data, contiguous_values, 0, idx_max - values_count, &v_min, &v_max);
+
+            float span_min = v_min, span_max = v_max;
+            if (prev_v_min <= prev_v_max)
+            {
+                span_min = ImMin(span_min, prev_v_max);
+                span_max = ImMax(span_max, prev_v_min);
+            }
+            prev_v_min = v_min;
+            prev_v_max = v_max;
+            if (v_min > v_max) // All values are NaN
+                continue;
+            float y0, y1;
+            if (plot_type == ImGuiPlotType_Lines)
+            {
+                y0 = ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((span_max - scale_min) * inv_scale));
+                y1 = ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((span_min - scale_min) * inv_scale));
+            }
+            else
+            {
+                y0 = ImMin(ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((v_max - scale_min) * inv_scale)), histogram_zero_line_y);
+                y1 = ImMax(ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((v_min - scale_min) * inv_scale)), histogram_zero_line_y);
+            }
+            const float x = inner_bb.Min.x + (float)n;
+            const bool is_hovered = (idx_hovered >= v_idx_min && idx_hovered < v_idx_max);
+            window->DrawList->AddRectFilled(ImVec2(x, IM_FLOOR(y0)), ImVec2(x + 1.0f, IM_FLOOR(y1) + 1.0f), is_hovered ? col_hovered : col_base);
+        }
+
+        for (int n = 0; lod == NULL && n < res_w; n++)
         {
             const float t1 = t0 + t_step;
             const int v1_idx = (int)(t0 * item_count + 0.5f);
@@ -6504,19 +6821,191 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
     return idx_hovered;
 }
 
-struct ImGuiPlotArrayGetterData
+// Accumulate the min/max of values [idx_min, idx_max) of a stream, indices being counted since the first value ever pushed.
+static void PlotStreamReduceMinMax(const ImGuiPlotStream& stream, ImU64 idx_min, ImU64 idx_max, float* io_min, float* io_max)
 {
-    const float* Values;
-    int Stride;
-
-    ImGuiPlotArrayGetterData(const float* values, int stride) { Values = values; Stride = stride; }
-};
+    const int capacity = stream.Values.Size;
+    while (idx_min < idx_max)
+    {
+        const int offset = (int)(idx_min % (ImU64)capacity);
+        const int count = (int)ImMin(idx_max - idx_min, (ImU64)(capacity - offset));
+        PlotReduceMinMax(stream.Values.Data + offset, count, io_min, io_max);
+        idx_min += (ImU64)count;
+    }
+}
 
-static float Plot_ArrayGetter(void* data, int idx)
+// Newest values are displayed on the right side of the frame. Return index of the hovered value (0 is the oldest) or -1 if none are hovered.
+int ImGui::PlotStreamEx(ImGuiPlotType plot_type, const char* label, const ImGuiPlotStream& stream, const char* overlay_text, float scale_min, float scale_max, ImVec2 frame_size)
 {
-    ImGuiPlotArrayGetterData* plot_data = (ImGuiPlotArrayGetterData*)data;
-    const float v = *(const float*)(const void*)((const unsigned char*)plot_data->Values + (size_t)idx * plot_data->Stride);
-    return v;
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return -1;
+
+    const ImGuiStyle& style = g.Style;
+    const ImGuiID id = window->GetID(label);
+
+    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    if (frame_size.x == 0.0f)
+        frame_size.x = CalcItemWidth();
+    if (frame_size.y == 0.0f)
+        frame_size.y = label_size.y + (style.FramePadding.y * 2);
+
+    const ImRect frame_bb(window->DC.CursorPos, window->DC.CursorPos + frame_size);
+    const ImRect inner_bb(frame_bb.Min + style.FramePadding, frame_bb.Max - style.FramePadding);
+    const ImRect total_bb(frame_bb.Min, frame_bb.Max + ImVec2(label_size.x > 0.0f ? style.ItemInnerSpacing.x + label_size.x : 0.0f, 0));
+    ItemSize(total_bb, style.FramePadding.y);
+    if (!ItemAdd(total_bb, 0, &frame_bb))
+        return -1;
+    const bool hovered = ItemHoverable(frame_bb, id);
+
+    RenderFrame(frame_bb.Min, frame_bb.Max, GetColorU32(ImGuiCol_FrameBg), true, style.FrameRounding);
+
+    const int capacity = stream.Capacity();
+    const int values_count = stream.Size();
+    const int res_w = (int)(inner_bb.Max.x - inner_bb.Min.x);
+    int idx_hovered = -1;
+    if (values_count > 0 && res_w > 0)
+    {
+        // Columns of 'values_per_column' values. With more than one value per column, the oldest and newest displayed columns
+        // may be partial, so we need an extra column to display the whole capacity.
+        const int values_per_column = (capacity + res_w - 1) / res_w;
+        const int columns_count = (capacity + values_per_column - 1) / values_per_column + (values_per_column > 1 ? 1 : 0);
+        const ImU64 values_per_column_u64 = (ImU64)values_per_column;
+
+        ImGuiPlotStreamState* state = g.PlotStreams.GetOrAddByKey(id);
+        if (state->Stream != &stream || state->Capacity != capacity || state->ValuesPerColumn != values_per_column || state->Columns.Size != columns_count || stream.Count < state->ColumnsEnd * values_per_column_u64)
+        {
+            state->Stream = &stream;
+            state->Capacity = capacity;
+            state->ValuesPerColumn = values_per_column;
+            state->ColumnsEnd = 0;
+            state->Columns.resize(columns_count);
+        }
+        state->ID = id;
+        state->LastTimeActive = (float)g.Time;
+
+        // Compute columns completed since last frame
+        const ImU64 idx_first = stream.Count - (ImU64)values_count;
+        const ImU64 column_first = idx_first / values_per_column_u64;
+        const ImU64 column_last = (stream.Count - 1) / values_per_column_u64;
+        const ImU64 columns_full_end = stream.Count / values_per_column_u64;
+        for (ImU64 column_n = ImMax(state->ColumnsEnd, column_first); column_n < columns_full_end; column_n++)
+        {
+            ImVec2 column(FLT_MAX, -FLT_MAX);
+            PlotStreamReduceMinMax(stream, ImMax(column_n * values_per_column_u64, idx_first), (column_n + 1) * values_per_column_u64, &column.x, &column.y);
+            state->Columns[(int)(column_n % (ImU64)columns_count)] = column;
+        }
+        state->ColumnsEnd = columns_full_end;
+
+        // Gather displayed columns. Partially overwritten (oldest) and partially pushed (newest) columns are computed every frame.
+        const ImU64 column_display_start = (column_last + 1 >= (ImU64)columns_count) ? column_last + 1 - (ImU64)columns_count : 0;
+        const ImU64 column_start = ImMax(column_first, column_display_start);
+        state->VisibleColumns.resize((int)(column_last - column_start + 1));
+        float v_min = FLT_MAX;
+        float v_max = -FLT_MAX;
+        for (ImU64 column_n = column_start; column_n <= column_last; column_n++)
+        {
+            ImVec2 column(FLT_MAX, -FLT_MAX);
+            if (column_n * values_per_column_u64 >= idx_first && column_n < columns_full_end)
+                column = state->Columns[(int)(column_n % (ImU64)columns_count)];
+            else
+                PlotStreamReduceMinMax(stream, ImMax(column_n * values_per_column_u64, idx_first), ImMin((column_n + 1) * values_per_column_u64, stream.Count), &column.x, &column.y);
+            state->VisibleColumns[(int)(column_n - column_start)] = column;
+            v_min = ImMin(v_min, column.x);
+            v_max = ImMax(v_max, column.y);
+        }
+
+        // Determine scale from values if not specified
+        if (scale_min == FLT_MAX)
+            scale_min = v_min;
+        if (scale_max == FLT_MAX)
+            scale_max = v_max;
+        const float inv_scale = (scale_min == scale_max) ? 0.0f : (1.0f / (scale_max - scale_min));
+        const float histogram_zero_line_t = (scale_min * scale_max < 0.0f) ? (-scale_min * inv_scale) : (scale_min < 0.0f ? 0.0f : 1.0f);   // Where does the zero line stands
+        const float histogram_zero_line_y = ImLerp(inner_bb.Min.y, inner_bb.Max.y, histogram_zero_line_t);
+        const float column_w = (inner_bb.Max.x - inner_bb.Min.x) / (float)columns_count;
+        const float x_start = inner_bb.Min.x + (float)(columns_count - state->VisibleColumns.Size) * column_w;
+
+        // Tooltip on hover
+        int column_hovered = -1;
+        if (hovered && inner_bb.Contains(g.IO.MousePos))
+        {
+            column_hovered = (int)ImFloor((g.IO.MousePos.x - x_start) / column_w);
+            if (column_hovered >= 0 && column_hovered < state->VisibleColumns.Size)
+            {
+                const ImU64 column_n = column_start + (ImU64)column_hovered;
+                const int v_idx_min = (int)(ImMax(column_n * values_per_column_u64, idx_first) - idx_first);
+                const int v_idx_max = (int)(ImMin((column_n + 1) * values_per_column_u64, stream.Count) - idx_first) - 1;
+                const ImVec2 column = state->VisibleColumns[column_hovered];
+                if (v_idx_min == v_idx_max)
+                    SetTooltip("%d: %8.4g", v_idx_min, column.x);
+                else
+                    SetTooltip("%d..%d: %8.4g..%8.4g", v_idx_min, v_idx_max, column.x, column.y);
+                idx_hovered = v_idx_max;
+            }
+            else
+            {
+                column_hovered = -1;
+            }
+        }
+
+        const ImU32 col_base = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLines : ImGuiCol_PlotHistogram);
+        const ImU32 col_hovered = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLinesHovered : ImGuiCol_PlotHistogramHovered);
+
+        // Lines with one value per column are drawn as a polyline through the center of each column, otherwise each column
+        // draws a vertical span covering its min/max (extended to reach the previous span for lines, so the plot stays continuous).
+        ImDrawList* draw_list = window->DrawList;
+        ImVec2 prev_column(FLT_MAX, -FLT_MAX);
+        for (int n = 0; n < state->VisibleColumns.Size; n++)
+        {
+            const ImVec2 column = state->VisibleColumns[n];
+            const float x = x_start + (float)n * column_w;
+            const bool is_valid = (column.x <= column.y); // Not all NaN values
+            if (plot_type == ImGuiPlotType_Lines && values_per_column == 1)
+            {
+                if (is_valid)
+                    draw_list->PathLineTo(ImVec2(x + column_w * 0.5f, ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((column.x - scale_min) * inv_scale))));
+                if (!is_valid || n == state->VisibleColumns.Size - 1)
+                    draw_list->PathStroke(col_base, 0, 1.0f);
+                continue;
+            }
+            ImVec2 span = column;
+            if (plot_type == ImGuiPlotType_Lines && prev_column.x <= prev_column.y)
+                span = ImVec2(ImMin(span.x, prev_column.y), ImMax(span.y, prev_column.x));
+            prev_column = column;
+            if (!is_valid)
+                continue;
+            float y0 = ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((span.y - scale_min) * inv_scale));
+            float y1 = ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((span.x - scale_min) * inv_scale));
+            float x0 = IM_FLOOR(x);
+            float x1 = ImMax(IM_FLOOR(x + column_w), x0 + 1.0f);
+            if (plot_type == ImGuiPlotType_Histogram)
+            {
+                y0 = ImMin(y0, histogram_zero_line_y);
+                y1 = ImMax(y1, histogram_zero_line_y);
+                if (x1 >= x0 + 3.0f)
+                    x1 -= 1.0f;
+            }
+            draw_list->AddRectFilled(ImVec2(x0, IM_FLOOR(y0)), ImVec2(x1, IM_FLOOR(y1) + 1.0f), n == column_hovered ? col_hovered : col_base);
+        }
+
+        // Highlight hovered value of a polyline
+        if (plot_type == ImGuiPlotType_Lines && values_per_column == 1 && column_hovered != -1 && state->VisibleColumns[column_hovered].x == state->VisibleColumns[column_hovered].x)
+        {
+            const float y = ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((state->VisibleColumns[column_hovered].x - scale_min) * inv_scale));
+            draw_list->AddCircleFilled(ImVec2(x_start + ((float)column_hovered + 0.5f) * column_w, y), 2.0f, col_hovered);
+        }
+    }
+
+    // Text overlay
+    if (overlay_text)
+        RenderTextClipped(ImVec2(frame_bb.Min.x, frame_bb.Min.y + style.FramePadding.y), frame_bb.Max, overlay_text, NULL, NULL, ImVec2(0.5f, 0.0f));
+
+    if (label_size.x > 0.0f)
+        RenderText(ImVec2(frame_bb.Max.x + style.ItemInnerSpacing.x, inner_bb.Min.y), label);
+
+    return idx_hovered;
 }
 
 void ImGui::PlotLines(const char* label, const float* values, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride)
@@ -6541,6 +7030,25 @@ void ImGui::PlotHistogram(const char* label, float (*values_getter)(void* data,
     PlotEx(ImGuiPlotType_Histogram, label, values_getter, data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
 }
 
+void ImGui::PlotLines(const char* label, const ImGuiPlotStream& stream, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    PlotStreamEx(ImGuiPlotType_Lines, label, stream, overlay_text, scale_min, scale_max, graph_size);
+}
+
+void ImGui::PlotHistogram(const char* label, const ImGuiPlotStream& stream, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    PlotStreamEx(ImGuiPlotType_Histogram, label, stream, overlay_text, scale_min, scale_max, graph_size);
+}
+
+void ImGui::SetNextPlotDataVersion(ImU32 version)
+{
+    ImGuiContext& g = *GImGui;
+    if (g.CurrentWindow->SkipItems)
+        return;
+    g.NextItemData.Flags |= ImGuiNextItemDataFlags_HasPlotDataVersion;
+    g.NextItemData.PlotDataVersion = version;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Value helpers
 // Those is not very useful, legacy API.